@@ -27,6 +27,7 @@
 #include <functional>
 #include <type_traits>
 
+#include "iipptl_float16.hpp"
 #include "ipp.h"
 
 namespace IntelIppTL {
@@ -72,6 +73,10 @@ class CIppAllocator final {
       ippsMalloc = ippsMalloc_64sc;
     } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
       ippsMalloc = ippsMalloc_64fc;
+    } else if constexpr (Private::ippIsFloat16<IppType>) {
+      ippsMalloc = [](int size) {
+        return reinterpret_cast<IppType *>(ippsMalloc_16s(size));
+      };
     } else {
       static_assert(std::is_void_v<IppType>, "unsupported type");
     }
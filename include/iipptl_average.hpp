@@ -21,24 +21,64 @@
 
 #include <vector>
 
+#include "iipptl_convert.hpp"
+#include "iipptl_math.hpp"
 #include "iipptl_vector.hpp"
 
 namespace IntelIppTL {
 
-template <typename IppType>
+enum class IppAverageMode {
+  Boxcar,
+  Exponential,
+  MaxHold,
+  MinHold,
+  SlidingMax,
+  SlidingMin
+};
+
+// StorageType lets the ring of the windowed modes hold a narrower type
+// (IppFloat16, IppBFloat16) while sums and extremes stay in IppType. The
+// boxcar sum adds and later subtracts the stored value, so rounding never
+// accumulates.
+template <typename IppType, typename StorageType = IppType>
 class CIppAverage {
  public:
   using ValueType = IppType;
   using IppVector = CIppVector<IppType>;
+  using StorageVector = CIppVector<StorageType>;
   using SizeType = typename IppVector::SizeType;
+  using BaseType = Private::IppBaseTypeT<IppType>;
   CIppAverage() = default;
-  CIppAverage(SizeType vectorSize, SizeType averageSize = 1)
-      : m_AverageVector{vectorSize},
-        m_RingBuffer(averageSize, IppVector(vectorSize)) {
+  CIppAverage(SizeType vectorSize, SizeType averageSize = 1,
+              IppAverageMode mode = IppAverageMode::Boxcar)
+      : m_Mode{mode},
+        m_AverageSize{averageSize},
+        m_AverageVector{vectorSize},
+        m_RebaseVector{(k_Rebase && mode == IppAverageMode::Boxcar)
+                           ? vectorSize
+                           : 0},
+        m_PrefixVector{(mode == IppAverageMode::SlidingMax ||
+                        mode == IppAverageMode::SlidingMin)
+                           ? vectorSize
+                           : 0},
+        m_FrameVector{k_Storage ? vectorSize : 0},
+        m_SuffixVector{(k_Storage && (mode == IppAverageMode::SlidingMax ||
+                                      mode == IppAverageMode::SlidingMin))
+                           ? vectorSize
+                           : 0},
+        m_RingBuffer((mode == IppAverageMode::Boxcar ||
+                      mode == IppAverageMode::SlidingMax ||
+                      mode == IppAverageMode::SlidingMin)
+                         ? averageSize
+                         : 0,
+                     StorageVector(vectorSize)) {
     if (vectorSize <= 0 || averageSize <= 0) {
       throw std::invalid_argument("CIppAverage: invalid ctor argument");
     }
-    reset();
+    if (isDetector() && Private::ippComponents<IppType> != 1) {
+      throw std::invalid_argument("CIppAverage: mode requires real type");
+    }
+    alpha(2. / (averageSize + 1));
   }
   CIppAverage(CIppAverage const &) = default;
   CIppAverage(CIppAverage &&) noexcept = default;
@@ -50,15 +90,38 @@ class CIppAverage {
     return *this;
   }
   void add(IppVector const &vector) {
+    switch (m_Mode) {
+      case IppAverageMode::Exponential:
+        addExponential(vector);
+        return;
+      case IppAverageMode::MaxHold:
+      case IppAverageMode::MinHold:
+        addHold(vector);
+        return;
+      case IppAverageMode::SlidingMax:
+      case IppAverageMode::SlidingMin:
+        addSliding(vector);
+        return;
+      default:
+        break;
+    }
     if (m_NotFirstCycle) {
-      m_AverageVector -= m_RingBuffer[m_AverageCount];
+      m_AverageVector -= frame(m_AverageCount);
+    }
+    store(vector, m_AverageCount);
+    auto const &stored{frame(m_AverageCount)};
+    m_AverageVector += stored;
+    if constexpr (k_Rebase) {
+      m_RebaseVector += stored;
     }
-    m_RingBuffer[m_AverageCount] = vector;
-    m_AverageVector += m_RingBuffer[m_AverageCount];
     ++m_AverageCount;
     if (m_AverageCount == SizeType(m_RingBuffer.size())) {
       m_AverageCount = 0;
       m_NotFirstCycle = true;
+      if constexpr (k_Rebase) {
+        std::swap(m_AverageVector, m_RebaseVector);
+        m_RebaseVector.clear();
+      }
     }
   }
   void get(IppVector &vector) const {
@@ -66,31 +129,60 @@ class CIppAverage {
     normalize(vector);
   }
   inline void normalize(IppVector &vector) const {
-    auto norm{(m_NotFirstCycle) ? SizeType(m_RingBuffer.size())
-                                : m_AverageCount};
-    vector /= norm;
+    if (isDetector()) {
+      return;
+    }
+    Private::ippScale(BaseType(norm()), vector.begin(), vector.size());
   }
   inline void data(IppVector &vector) const { vector = m_AverageVector; }
   inline IppVector const &data() const noexcept { return m_AverageVector; }
   inline IppVector &data() noexcept { return m_AverageVector; }
   void reset() {
     m_AverageVector.clear();
+    m_RebaseVector.clear();
+    m_PrefixVector.clear();
     for (auto &vector : m_RingBuffer) {
-      vector = 0;
+      vector.clear();
+    }
+    if (isDetector()) {
+      // Narrow storage overflows at the 32f limits; infinities convert.
+      auto const limit{k_Storage ? std::numeric_limits<BaseType>::infinity()
+                                 : std::numeric_limits<BaseType>::max()};
+      auto const initial{(m_Mode == IppAverageMode::MaxHold ||
+                          m_Mode == IppAverageMode::SlidingMax)
+                             ? -limit
+                             : limit};
+      m_AverageVector = initial;
+      for (SizeType i{}; i < SizeType(m_RingBuffer.size()); ++i) {
+        store(m_AverageVector, i);
+      }
     }
     m_AverageCount = 0;
     m_NotFirstCycle = false;
+    m_Scale = 1;
+    m_Decay = 1;
   }
-  inline SizeType size() const noexcept {
-    return SizeType(m_RingBuffer.size());
+  // Average length as configured; the ring length in the windowed modes.
+  inline SizeType size() const noexcept { return m_AverageSize; }
+  inline IppAverageMode mode() const noexcept { return m_Mode; }
+  inline double alpha() const noexcept { return m_Alpha; }
+  void alpha(double value) {
+    if (value <= 0 || value > 1) {
+      throw std::invalid_argument("CIppAverage: invalid alpha argument");
+    }
+    m_Alpha = value;
+    reset();
   }
   void reinit(SizeType vectorSize, SizeType averageSize = 1) {
     if (vectorSize <= 0 || averageSize <= 0) {
       throw std::invalid_argument("CIppAverage: invalid reinit argument");
     }
-    if (SizeType(m_RingBuffer.size()) != averageSize ||
-        m_AverageVector.size() != vectorSize) {
-      auto tmp{CIppAverage(vectorSize, averageSize)};
+    if (m_AverageSize != averageSize || m_AverageVector.size() != vectorSize) {
+      auto tmp{CIppAverage(vectorSize, averageSize, m_Mode)};
+      if (m_AverageSize == averageSize) {
+        // Only the vector size changes: a custom alpha survives.
+        tmp.alpha(m_Alpha);
+      }
       std::swap(*this, tmp);
       reset();
     }
@@ -99,24 +191,154 @@ class CIppAverage {
     if (averageSize <= 0) {
       throw std::invalid_argument("CIppAverage: invalid resize argument");
     }
-    if (SizeType(m_RingBuffer.size()) != averageSize) {
-      m_RingBuffer.resize(averageSize, IppVector(m_AverageVector.size()));
+    m_AverageSize = averageSize;
+    if (m_Mode == IppAverageMode::Exponential) {
+      alpha(2. / (averageSize + 1));
+    } else if (m_Mode == IppAverageMode::MaxHold ||
+               m_Mode == IppAverageMode::MinHold) {
+      reset();
+    } else if (SizeType(m_RingBuffer.size()) != averageSize) {
+      m_RingBuffer.resize(averageSize, StorageVector(m_AverageVector.size()));
       reset();
       // TODO: оптимизировать, вместо очистки сделать копирование.
     }
   }
 
  private:
+  // Single precision running sums drift, so the sum is rebuilt from scratch
+  // alongside it and swapped in once per ring cycle.
+  static constexpr bool k_Rebase{std::is_same_v<BaseType, Ipp32f>};
+  // The accumulator holds sum(x[i] / (1 - alpha)^i), so every add() is a
+  // single AddProductC pass; it is rescaled before the weight overflows.
+  static constexpr double k_RescaleLimit{1e6};
+  static constexpr bool k_Storage{!std::is_same_v<IppType, StorageType>};
+  void store(IppVector const &vector, SizeType index) {
+    Private::ippConvertStorage(vector, m_RingBuffer[index]);
+  }
+  // A ring entry in IppType; converted into a scratch vector (valid until
+  // the next call) when the ring stores another type.
+  IppVector const &frame(SizeType index) {
+    if constexpr (k_Storage) {
+      Private::ippConvertStorage(m_RingBuffer[index], m_FrameVector);
+      return m_FrameVector;
+    } else {
+      return m_RingBuffer[index];
+    }
+  }
+  void addExponential(IppVector const &vector) {
+    Private::ippVectorIsEqual(vector, m_AverageVector);
+    auto const retention{1 - m_Alpha};
+    if (retention == 0) {
+      m_AverageVector = vector;
+      m_Decay = 0;
+      return;
+    }
+    auto scale{m_Scale / retention};
+    if (scale > k_RescaleLimit) {
+      Private::ippScale(BaseType(1 / m_Scale), m_AverageVector.begin(),
+                        m_AverageVector.size());
+      scale = 1 / retention;
+    }
+    Private::ippAddScaled(vector.begin(), BaseType(scale),
+                          m_AverageVector.begin(), m_AverageVector.size());
+    m_Scale = scale;
+    m_Decay *= retention;
+  }
+  inline bool isDetector() const noexcept {
+    return m_Mode != IppAverageMode::Boxcar &&
+           m_Mode != IppAverageMode::Exponential;
+  }
+  void every(IppVector const &source, IppVector &vector) const {
+    if constexpr (Private::ippComponents<IppType> == 1) {
+      if (m_Mode == IppAverageMode::MaxHold ||
+          m_Mode == IppAverageMode::SlidingMax) {
+        ippMaxEvery(source, vector);
+      } else {
+        ippMinEvery(source, vector);
+      }
+    }
+  }
+  void every(IppVector const &sourceA, IppVector const &sourceB,
+             IppVector &dest) const {
+    if constexpr (Private::ippComponents<IppType> == 1) {
+      if (m_Mode == IppAverageMode::SlidingMax) {
+        ippMaxEvery(sourceA, sourceB, dest);
+      } else {
+        ippMinEvery(sourceA, sourceB, dest);
+      }
+    }
+  }
+  void addHold(IppVector const &vector) { every(vector, m_AverageVector); }
+  // Van Herk/Gil-Werman: the window is the suffix extreme of the previous
+  // block of frames combined with the prefix extreme of the current one.
+  // The ring holds the suffix extremes, rebuilt in place once per block.
+  void addSliding(IppVector const &vector) {
+    auto const blockSize{SizeType(m_RingBuffer.size())};
+    store(vector, m_AverageCount);
+    auto const &stored{frame(m_AverageCount)};
+    if (m_AverageCount == 0) {
+      m_PrefixVector = stored;
+    } else {
+      every(stored, m_PrefixVector);
+    }
+    if (m_AverageCount + 1 == blockSize) {
+      m_AverageVector = m_PrefixVector;
+      rebuildSuffix();
+      m_AverageCount = 0;
+      m_NotFirstCycle = true;
+    } else {
+      every(frame(m_AverageCount + 1), m_PrefixVector, m_AverageVector);
+      ++m_AverageCount;
+    }
+  }
+  void rebuildSuffix() {
+    auto const blockSize{SizeType(m_RingBuffer.size())};
+    if constexpr (k_Storage) {
+      // Extremes of stored values are exactly representable, so storing
+      // them back loses nothing.
+      Private::ippConvertStorage(m_RingBuffer[blockSize - 1], m_SuffixVector);
+      for (auto i{blockSize - 2}; i >= 0; --i) {
+        Private::ippConvertStorage(m_RingBuffer[i], m_FrameVector);
+        every(m_SuffixVector, m_FrameVector);
+        store(m_FrameVector, i);
+        std::swap(m_SuffixVector, m_FrameVector);
+      }
+    } else {
+      for (auto i{blockSize - 2}; i >= 0; --i) {
+        every(m_RingBuffer[i + 1], m_RingBuffer[i]);
+      }
+    }
+  }
+  double norm() const noexcept {
+    if (m_Mode == IppAverageMode::Exponential) {
+      // Bias-corrected: divides out the weight missing after a zero start.
+      return (m_Decay == 1) ? 0 : m_Alpha / (m_Scale * (1 - m_Decay));
+    }
+    auto count{(m_NotFirstCycle) ? SizeType(m_RingBuffer.size())
+                                 : m_AverageCount};
+    return (count == 0) ? 0 : 1. / count;
+  }
+  IppAverageMode m_Mode{IppAverageMode::Boxcar};
+  SizeType m_AverageSize{};
+  double m_Alpha{1};
+  double m_Scale{1};
+  double m_Decay{1};
   SizeType m_AverageCount{};
   bool m_NotFirstCycle{false};
   IppVector m_AverageVector{};
-  std::vector<IppVector> m_RingBuffer{};
+  IppVector m_RebaseVector{};
+  IppVector m_PrefixVector{};
+  IppVector m_FrameVector{};
+  IppVector m_SuffixVector{};
+  std::vector<StorageVector> m_RingBuffer{};
 };
 
 using CIppAverage64f = CIppAverage<Ipp64f>;
 using CIppAverage64fc = CIppAverage<Ipp64fc>;
 using CIppAverage32f = CIppAverage<Ipp32f>;
 using CIppAverage32fc = CIppAverage<Ipp32fc>;
+using CIppAverage16f = CIppAverage<Ipp32f, IppFloat16>;
+using CIppAverage16bf = CIppAverage<Ipp32f, IppBFloat16>;
 
 }  // namespace IntelIppTL
 
@@ -19,6 +19,10 @@
 #ifndef IIPPTL_CONVERT_HPP
 #define IIPPTL_CONVERT_HPP
 
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
 #include "iipptl_vector.hpp"
 
 namespace IntelIppTL {
@@ -113,6 +117,177 @@ inline void ippConvertImag(CIppVector<Ipp64fc> const &source,
       ippsImag_64fc(source.begin(), destIm.begin(), destIm.size()));
 }
 
+inline void ippConvert(CIppVector<Ipp32f> const &source,
+                       CIppVector<IppFloat16> &dest,
+                       IppRoundMode round = ippRndNear) {
+  Private::ippVectorIsEqual(source, dest);
+  IPP_CHECK_STATUS(ippsConvert_32f16f(source.begin(),
+                                      reinterpret_cast<Ipp16f *>(dest.begin()),
+                                      dest.size(), round));
+}
+
+inline void ippConvert(CIppVector<IppFloat16> const &source,
+                       CIppVector<Ipp32f> &dest) {
+  Private::ippVectorIsEqual(source, dest);
+  IPP_CHECK_STATUS(
+      ippsConvert_16f32f(reinterpret_cast<Ipp16f const *>(source.begin()),
+                         dest.begin(), dest.size()));
+}
+
+inline void ippConvert(CIppVector<Ipp32f> const &source,
+                       CIppVector<IppBFloat16> &dest) {
+  Private::ippVectorIsEqual(source, dest);
+  Private::ippConvertBFloat16(source.begin(), dest.begin(), dest.size());
+}
+
+inline void ippConvert(CIppVector<IppBFloat16> const &source,
+                       CIppVector<Ipp32f> &dest) {
+  Private::ippVectorIsEqual(source, dest);
+  Private::ippConvertBFloat16(source.begin(), dest.begin(), dest.size());
+}
+
+// Saturating float-to-integer conversions: dest = source * 2^-scaleFactor
+// rounded by the given mode and clamped to the range of the integer type.
+inline void ippConvert(CIppVector<Ipp32f> const &source,
+                       CIppVector<Ipp32s> &dest,
+                       IppRoundMode round = ippRndNear, int scaleFactor = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  IPP_CHECK_STATUS(ippsConvert_32f32s_Sfs(source.begin(), dest.begin(),
+                                          dest.size(), round, scaleFactor));
+}
+
+inline void ippConvert(CIppVector<Ipp32f> const &source,
+                       CIppVector<Ipp16s> &dest,
+                       IppRoundMode round = ippRndNear, int scaleFactor = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  IPP_CHECK_STATUS(ippsConvert_32f16s_Sfs(source.begin(), dest.begin(),
+                                          dest.size(), round, scaleFactor));
+}
+
+inline void ippConvert(CIppVector<Ipp32f> const &source,
+                       CIppVector<Ipp8u> &dest,
+                       IppRoundMode round = ippRndNear, int scaleFactor = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  IPP_CHECK_STATUS(ippsConvert_32f8u_Sfs(source.begin(), dest.begin(),
+                                         dest.size(), round, scaleFactor));
+}
+
+// Both components are converted in one pass over 2 * size floats.
+inline void ippConvert(CIppVector<Ipp32fc> const &source,
+                       CIppVector<Ipp16sc> &dest,
+                       IppRoundMode round = ippRndNear, int scaleFactor = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  IPP_CHECK_STATUS(ippsConvert_32f16s_Sfs(
+      reinterpret_cast<Ipp32f const *>(source.begin()),
+      reinterpret_cast<Ipp16s *>(dest.begin()), 2 * dest.size(), round,
+      scaleFactor));
+}
+
+namespace Private {
+
+// Moves a vector between its compute type and the element type a container
+// stores it in; a plain copy when both are the same.
+template <typename IppType, typename StorageType>
+void ippConvertStorage(CIppVector<IppType> const &source,
+                       CIppVector<StorageType> &dest) {
+  if constexpr (std::is_same_v<IppType, StorageType>) {
+    dest = source;
+  } else {
+    ippConvert(source, dest);
+  }
+}
+
+}  // namespace Private
+
+// Raw IQ layouts accepted by ippIngest; every complex sample is an I/Q
+// pair in this order.
+enum class IppSampleFormat {
+  Int16,     // two little-endian 16-bit signed words
+  UInt8,     // two offset-binary bytes, 128 is zero
+  Packed12,  // two 12-bit signed values packed into three bytes
+};
+
+namespace Private {
+
+inline constexpr int k_IngestChunkSize{1024};
+
+inline int ippSampleBytes(IppSampleFormat format) {
+  switch (format) {
+    case IppSampleFormat::Int16:
+      return 4;
+    case IppSampleFormat::UInt8:
+      return 2;
+    case IppSampleFormat::Packed12:
+      return 3;
+  }
+  throw std::invalid_argument("ippSampleBytes: invalid format");
+}
+
+// I = b0 | (b1 & 0x0F) << 8, Q = b1 >> 4 | b2 << 4, both sign-extended.
+inline void ippUnpack12(Ipp8u const *source, Ipp32f *dest, int size) {
+  for (int sample{}; sample < size; ++sample, source += 3) {
+    auto const re{Ipp16s((source[0] | (source[1] & 0x0F) << 8) << 4)};
+    auto const im{Ipp16s((source[1] >> 4 | source[2] << 4) << 4)};
+    dest[2 * sample] = Ipp32f(re >> 4);
+    dest[2 * sample + 1] = Ipp32f(im >> 4);
+  }
+}
+
+}  // namespace Private
+
+// Converts dest.size() raw samples into dest = gain * (sample - offset)
+// in one pass: each chunk is converted and then normalized while it is
+// still in L1. Offset-binary bytes are re-centred before the offset is
+// applied, so offset only carries the DC correction. The source must hold
+// at least dest.size() samples of the given format.
+inline void ippIngest(Ipp8u const *source, int sourceBytes,
+                      IppSampleFormat format, CIppVector<Ipp32fc> &dest,
+                      Ipp32f gain = 1, Ipp32fc offset = {}) {
+  auto const bytes{Private::ippSampleBytes(format)};
+  if (source == nullptr || gain == 0 || sourceBytes / bytes < dest.size()) {
+    throw std::invalid_argument("ippIngest: invalid argument");
+  }
+  if (format == IppSampleFormat::UInt8) {
+    offset.re += 128;
+    offset.im += 128;
+  }
+  auto const size{dest.size()};
+  for (int chunk{}; chunk < size; chunk += Private::k_IngestChunkSize) {
+    auto const length{std::min(Private::k_IngestChunkSize, size - chunk)};
+    auto const *raw{source + chunk * bytes};
+    auto *block{dest.begin() + chunk};
+    auto *real{reinterpret_cast<Ipp32f *>(block)};
+    switch (format) {
+      case IppSampleFormat::Int16:
+        IPP_CHECK_STATUS(ippsConvert_16s32f(
+            reinterpret_cast<Ipp16s const *>(raw), real, 2 * length));
+        break;
+      case IppSampleFormat::UInt8:
+        IPP_CHECK_STATUS(ippsConvert_8u32f(raw, real, 2 * length));
+        break;
+      case IppSampleFormat::Packed12:
+        Private::ippUnpack12(raw, real, length);
+        break;
+    }
+    IPP_CHECK_STATUS(ippsNormalize_32fc_I(block, length, offset, 1 / gain));
+  }
+}
+
+inline void ippIngest(CIppVector<Ipp8u> const &source, IppSampleFormat format,
+                      CIppVector<Ipp32fc> &dest, Ipp32f gain = 1,
+                      Ipp32fc offset = {}) {
+  ippIngest(source.begin(), source.size(), format, dest, gain, offset);
+}
+
+inline void ippIngest(CIppVector<Ipp16sc> const &source,
+                      CIppVector<Ipp32fc> &dest, Ipp32f gain = 1,
+                      Ipp32fc offset = {}) {
+  Private::ippVectorIsEqual(source, dest);
+  ippIngest(reinterpret_cast<Ipp8u const *>(source.begin()),
+            source.size() * Private::ippSampleBytes(IppSampleFormat::Int16),
+            IppSampleFormat::Int16, dest, gain, offset);
+}
+
 }  // namespace IntelIppTL
 
 #endif  // IIPPTL_CONVERT_HPP
@@ -0,0 +1,170 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_DDC_HPP
+#define IIPPTL_DDC_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "iipptl_fir_design.hpp"
+#include "iipptl_resampler.hpp"
+#include "iipptl_vector.hpp"
+
+namespace IntelIppTL {
+
+// Digital down-converter: NCO mix, a chain of 2:1 half-band decimators and
+// a final channel FIR that decimates by the remaining factor. The input is
+// processed in L1-sized chunks that run through the whole chain before the
+// next chunk is touched, so the full-rate stream is read once.
+class CIppDDC {
+ public:
+  using ValueType = Ipp32fc;
+  using IppVector = CIppVector<Ipp32fc>;
+  using SizeType = typename IppVector::SizeType;
+  CIppDDC() = default;
+  CIppDDC(SizeType blockSize, double frequency, SizeType decimation,
+          double bandwidth = 0.8, SizeType tapsPerPhase = 24)
+      : m_BlockSize{blockSize}, m_Decimation{decimation} {
+    if (blockSize <= 0 || decimation <= 0 || std::abs(frequency) >= 0.5 ||
+        bandwidth <= 0 || bandwidth >= 1 || tapsPerPhase <= 0) {
+      throw std::invalid_argument("CIppDDC: invalid ctor argument");
+    }
+    setFrequency(frequency);
+    // Keep one factor of two for the channel filter so that its transition
+    // band can sit above the output band edge.
+    auto channelDecimation{decimation};
+    while (channelDecimation % 4 == 0) {
+      channelDecimation /= 2;
+      m_Stages.emplace_back(k_ChunkSize, 1, 2,
+                            ippFIRTaps<Ipp32fc>(ippFIRGenLowpass(
+                                0.25, k_HalfBandTaps)));
+    }
+    auto const cutoff{0.5 * bandwidth / channelDecimation};
+    auto const tapsSize{std::max(5, tapsPerPhase * channelDecimation)};
+    m_Stages.emplace_back(
+        k_ChunkSize, 1, channelDecimation,
+        ippFIRTaps<Ipp32fc>(ippFIRGenLowpass(cutoff, tapsSize)));
+    m_DestVector = IppVector(maxOutputSize());
+  }
+  CIppDDC(CIppDDC const &) = default;
+  CIppDDC(CIppDDC &&) noexcept = default;
+  CIppDDC &operator=(CIppDDC const &) = default;
+  CIppDDC &operator=(CIppDDC &&) noexcept = default;
+  virtual ~CIppDDC() noexcept = default;
+  void reset() {
+    m_Phase = 0;
+    m_DestSize = 0;
+    for (auto &stage : m_Stages) {
+      stage.reset();
+    }
+  }
+  // Frequency to be moved to DC, in cycles per input sample.
+  void setFrequency(double frequency) {
+    if (std::abs(frequency) >= 0.5) {
+      throw std::invalid_argument("CIppDDC: invalid frequency");
+    }
+    m_Frequency = frequency;
+    m_ToneFrequency = Ipp32f(frequency > 0 ? 1 - frequency : -frequency);
+  }
+  inline double frequency() const noexcept { return m_Frequency; }
+  SizeType maxOutputSize() const noexcept {
+    return m_BlockSize / m_Decimation + 1;
+  }
+  template <typename IppType>
+  SizeType process(IppType const *source, SizeType size, Ipp32fc *dest) {
+    if (size < 0 || size > m_BlockSize) {
+      throw std::out_of_range("CIppDDC: block size out of range");
+    }
+    SizeType written{};
+    for (SizeType pos{}; pos < size; pos += k_ChunkSize) {
+      auto const length{std::min(k_ChunkSize, size - pos)};
+      if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+        IPP_CHECK_STATUS(ippsTone_32fc(m_Chunk.data(), length, 1,
+                                       m_ToneFrequency, &m_Phase,
+                                       ippAlgHintAccurate));
+        IPP_CHECK_STATUS(ippsMul_32fc_I(source + pos, m_Chunk.data(), length));
+      } else if constexpr (std::is_same_v<IppType, Ipp16sc>) {
+        IPP_CHECK_STATUS(ippsTone_32fc(m_Stage.data(), length, 1,
+                                       m_ToneFrequency, &m_Phase,
+                                       ippAlgHintAccurate));
+        IPP_CHECK_STATUS(
+            ippsConvert_16s32f(reinterpret_cast<Ipp16s const *>(source + pos),
+                               reinterpret_cast<Ipp32f *>(m_Chunk.data()),
+                               2 * length));
+        IPP_CHECK_STATUS(
+            ippsMul_32fc_I(m_Stage.data(), m_Chunk.data(), length));
+      } else {
+        static_assert(std::is_void_v<IppType>, "unsupported type");
+      }
+      // Stages ping-pong between the two chunk buffers; the last one
+      // writes straight into dest.
+      auto *input{m_Chunk.data()};
+      auto *output{m_Stage.data()};
+      auto count{length};
+      for (auto &stage : m_Stages) {
+        if (&stage == &m_Stages.back()) {
+          output = dest + written;
+        }
+        count = stage.process(input, count, output);
+        std::swap(input, output);
+      }
+      written += count;
+    }
+    return written;
+  }
+  template <typename IppType>
+  SizeType process(CIppVector<IppType> const &source) {
+    m_DestSize = process(source.begin(), source.size(), m_DestVector.begin());
+    return m_DestSize;
+  }
+  template <typename IppType>
+  SizeType process(CIppVector<IppType> const &source, IppVector &dest) {
+    if (dest.size() < maxOutputSize()) {
+      throw std::out_of_range("CIppDDC: dest vector is too small");
+    }
+    return process(source.begin(), source.size(), dest.begin());
+  }
+  inline Ipp32fc const *data() const noexcept { return m_DestVector.begin(); }
+  inline SizeType size() const noexcept { return m_DestSize; }
+  inline SizeType decimation() const noexcept { return m_Decimation; }
+  inline SizeType blockSize() const noexcept { return m_BlockSize; }
+
+ private:
+  static constexpr SizeType k_ChunkSize{1024};
+  static constexpr SizeType k_HalfBandTaps{31};
+  SizeType m_BlockSize{};
+  SizeType m_Decimation{1};
+  SizeType m_DestSize{};
+  double m_Frequency{};
+  Ipp32f m_ToneFrequency{};
+  Ipp32f m_Phase{};
+  std::vector<CIppResampler32fc> m_Stages{};
+  std::array<Ipp32fc, k_ChunkSize> m_Chunk{};
+  std::array<Ipp32fc, k_ChunkSize> m_Stage{};
+  IppVector m_DestVector{};
+};
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_DDC_HPP
@@ -19,6 +19,11 @@
 #ifndef IIPPTL_DELAY_HPP
 #define IIPPTL_DELAY_HPP
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
 #include "iipptl_vector.hpp"
 
 namespace IntelIppTL {
@@ -108,6 +113,192 @@ using CIppDelay64fc = CIppDelay<Ipp64fc>;
 using CIppDelay32f = CIppDelay<Ipp32f>;
 using CIppDelay32fc = CIppDelay<Ipp32fc>;
 
+template <typename IppType>
+class CIppSampleDelay {
+ public:
+  using ValueType = IppType;
+  using IppVector = CIppVector<IppType>;
+  using SizeType = typename IppVector::SizeType;
+  using BaseType = Private::IppBaseTypeT<IppType>;
+  CIppSampleDelay() = default;
+  CIppSampleDelay(SizeType blockSize, SizeType maxDelay,
+                  SizeType channels = 1)
+      : m_BlockSize{blockSize},
+        m_HistorySize{maxDelay + k_InterpolationMargin},
+        m_MaxDelay{maxDelay},
+        m_History(channels, IppVector(blockSize + m_HistorySize)),
+        m_LastSize(channels),
+        m_Delay(channels),
+        m_Taps(channels) {
+    if (blockSize <= 0 || maxDelay < 0 || channels <= 0) {
+      throw std::invalid_argument("CIppSampleDelay: invalid ctor argument");
+    }
+    reset();
+  }
+  CIppSampleDelay(CIppSampleDelay const &) = default;
+  CIppSampleDelay(CIppSampleDelay &&) noexcept = default;
+  CIppSampleDelay &operator=(CIppSampleDelay const &) = default;
+  CIppSampleDelay &operator=(CIppSampleDelay &&) noexcept = default;
+  virtual ~CIppSampleDelay() noexcept = default;
+  void reset() {
+    for (auto &history : m_History) {
+      history.clear();
+    }
+    std::fill(m_LastSize.begin(), m_LastSize.end(), SizeType{});
+  }
+  void setDelay(double delay, SizeType channel = 0) {
+    checkChannel(channel);
+    // Written so that NaN fails the check before it reaches the cast.
+    if (!(delay >= 0 && delay <= m_MaxDelay)) {
+      throw std::invalid_argument("CIppSampleDelay: invalid delay argument");
+    }
+    auto const integer{SizeType(std::floor(delay))};
+    auto const fraction{delay - integer};
+    if (fraction != 0 && integer < 1) {
+      throw std::invalid_argument("CIppSampleDelay: invalid delay argument");
+    }
+    m_Delay[channel] = delay;
+    // Cubic Lagrange weights for nodes at delays integer-1 .. integer+2,
+    // i.e. the Farrow polynomials evaluated at the channel's fraction.
+    auto const mu{fraction};
+    m_Taps[channel] = {BaseType(-mu * (mu - 1) * (mu - 2) / 6),
+                       BaseType((mu + 1) * (mu - 1) * (mu - 2) / 2),
+                       BaseType(-(mu + 1) * mu * (mu - 2) / 2),
+                       BaseType((mu + 1) * mu * (mu - 1) / 6)};
+  }
+  inline double delay(SizeType channel = 0) const {
+    checkChannel(channel);
+    return m_Delay[channel];
+  }
+  void push(IppVector const &vector, SizeType channel = 0) {
+    checkChannel(channel);
+    if (vector.size() > m_BlockSize) {
+      throw std::invalid_argument("CIppSampleDelay: block is too large");
+    }
+    auto &history{m_History[channel]};
+    auto const shift{m_LastSize[channel]};
+    if (shift > 0) {
+      move(history.begin() + shift, history.begin(), m_HistorySize);
+    }
+    history.assign(vector, m_HistorySize);
+    m_LastSize[channel] = vector.size();
+  }
+  // Integer-delayed view of the last pushed block, valid until next push.
+  inline IppType const *data(SizeType channel = 0) const {
+    checkChannel(channel);
+    return m_History[channel].begin() + m_HistorySize -
+           SizeType(std::floor(m_Delay[channel]));
+  }
+  void get(IppVector &vector, SizeType channel = 0) const {
+    checkChannel(channel);
+    auto const size{m_LastSize[channel]};
+    if (vector.size() < size) {
+      throw std::invalid_argument("CIppSampleDelay: destination is too small");
+    }
+    if (size == 0) {
+      return;
+    }
+    auto const delay{m_Delay[channel]};
+    auto const *window{data(channel)};
+    if (delay == std::floor(delay)) {
+      copy(window, vector.begin(), size);
+      return;
+    }
+    auto const &taps{m_Taps[channel]};
+    auto const length{size * Private::ippComponents<IppType>};
+    auto *dest{reinterpret_cast<BaseType *>(vector.begin())};
+    auto tapWindow = [window](int node) {
+      return reinterpret_cast<BaseType const *>(window - node);
+    };
+    std::function<IppStatus(BaseType const *, BaseType, BaseType *, int)>
+        ippsMulC{}, ippsAddProductC{};
+    if constexpr (std::is_same_v<BaseType, Ipp64f>) {
+      ippsMulC = ippsMulC_64f;
+      ippsAddProductC = ippsAddProductC_64f;
+    } else if constexpr (std::is_same_v<BaseType, Ipp32f>) {
+      ippsMulC = ippsMulC_32f;
+      ippsAddProductC = ippsAddProductC_32f;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    IPP_CHECK_STATUS(ippsMulC(tapWindow(-1), taps[0], dest, length));
+    for (int node{}; node < 3; ++node) {
+      IPP_CHECK_STATUS(
+          ippsAddProductC(tapWindow(node), taps[node + 1], dest, length));
+    }
+  }
+  void process(IppVector const &source, IppVector &dest,
+               SizeType channel = 0) {
+    push(source, channel);
+    get(dest, channel);
+  }
+  void process(std::vector<IppVector> const &sources,
+               std::vector<IppVector> &dests) {
+    if (sources.size() != m_History.size() ||
+        dests.size() != m_History.size()) {
+      throw std::invalid_argument("CIppSampleDelay: invalid channels count");
+    }
+    for (SizeType channel{}; channel < channels(); ++channel) {
+      process(sources[channel], dests[channel], channel);
+    }
+  }
+  inline SizeType channels() const noexcept {
+    return SizeType(m_History.size());
+  }
+  inline SizeType blockSize() const noexcept { return m_BlockSize; }
+  inline SizeType maxDelay() const noexcept { return m_MaxDelay; }
+
+ private:
+  static constexpr SizeType k_InterpolationMargin{2};
+  inline void checkChannel(SizeType channel) const {
+    if (channel < 0 || channel >= channels()) {
+      throw std::out_of_range("CIppSampleDelay: channel out of range");
+    }
+  }
+  static void move(IppType const *source, IppType *dest, SizeType size) {
+    std::function<IppStatus(IppType const *, IppType *, int)> ippsMove{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      ippsMove = ippsMove_64f;
+    } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+      ippsMove = ippsMove_64fc;
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      ippsMove = ippsMove_32f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+      ippsMove = ippsMove_32fc;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    IPP_CHECK_STATUS(ippsMove(source, dest, size));
+  }
+  static void copy(IppType const *source, IppType *dest, SizeType size) {
+    std::function<IppStatus(IppType const *, IppType *, int)> ippsCopy{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      ippsCopy = ippsCopy_64f;
+    } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+      ippsCopy = ippsCopy_64fc;
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      ippsCopy = ippsCopy_32f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+      ippsCopy = ippsCopy_32fc;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    IPP_CHECK_STATUS(ippsCopy(source, dest, size));
+  }
+  SizeType m_BlockSize{};
+  SizeType m_HistorySize{};
+  SizeType m_MaxDelay{};
+  std::vector<IppVector> m_History{};
+  std::vector<SizeType> m_LastSize{};
+  std::vector<double> m_Delay{};
+  std::vector<std::array<BaseType, 4>> m_Taps{};
+};
+
+using CIppSampleDelay64f = CIppSampleDelay<Ipp64f>;
+using CIppSampleDelay64fc = CIppSampleDelay<Ipp64fc>;
+using CIppSampleDelay32f = CIppSampleDelay<Ipp32f>;
+using CIppSampleDelay32fc = CIppSampleDelay<Ipp32fc>;
+
 }  // namespace IntelIppTL
 
 #endif  // IIPPTL_DELAY_HPP
@@ -0,0 +1,131 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_FIR_HPP
+#define IIPPTL_FIR_HPP
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "iipptl_fir_init.hpp"
+#include "iipptl_vector.hpp"
+
+namespace IntelIppTL {
+
+template <typename IppType>
+class CIppFIR {
+ public:
+  using ValueType = IppType;
+  using IppVector = CIppVector<IppType>;
+  using SizeType = typename IppVector::SizeType;
+  using IppFIRInit = Detail::CIppFIRInit<IppType>;
+  using IppFIRSpec = typename IppFIRInit::FIRSpec;
+  CIppFIR() = default;
+  CIppFIR(IppVector const &taps, SizeType blockSize, SizeType channels = 1,
+          IppFIRAlgorithm algorithm = IppFIRAlgorithm::Auto)
+      : m_BlockSize{blockSize} {
+    if (taps.size() <= 0 || blockSize <= 0 || channels <= 0) {
+      throw std::invalid_argument("CIppFIR: invalid ctor argument");
+    }
+    m_FIRInit.reinit(taps, blockSize, algorithm);
+    m_Delay.assign(channels, IppVector(std::max(1, taps.size() - 1)));
+    reset();
+  }
+  CIppFIR(CIppFIR const &) = default;
+  CIppFIR(CIppFIR &&) noexcept = default;
+  CIppFIR &operator=(CIppFIR const &) = default;
+  CIppFIR &operator=(CIppFIR &&) noexcept = default;
+  virtual ~CIppFIR() noexcept = default;
+  void reinit(IppVector const &taps, SizeType blockSize,
+              SizeType channels = 1,
+              IppFIRAlgorithm algorithm = IppFIRAlgorithm::Auto) {
+    auto tmp{CIppFIR(taps, blockSize, channels, algorithm)};
+    std::swap(*this, tmp);
+  }
+  void reset() noexcept {
+    for (auto &delay : m_Delay) {
+      delay = 0;
+    }
+  }
+  void process(IppType const *source, IppType *dest, SizeType size,
+               SizeType channel = 0) {
+    if (size < 0 || size > m_BlockSize) {
+      throw std::out_of_range("CIppFIR: block size out of range");
+    }
+    if (size == 0) {
+      return;
+    }
+    std::function<IppStatus(IppType const *, IppType *, int, IppFIRSpec,
+                            IppType const *, IppType *, Ipp8u *)>
+        ippsFIRSR{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      ippsFIRSR = ippsFIRSR_64f;
+    } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+      ippsFIRSR = ippsFIRSR_64fc;
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      ippsFIRSR = ippsFIRSR_32f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+      ippsFIRSR = ippsFIRSR_32fc;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    auto *delay{m_Delay.at(channel).begin()};
+    IPP_CHECK_STATUS(ippsFIRSR(source, dest, size, m_FIRInit.firSpec(), delay,
+                               delay, m_FIRInit.memBuf()));
+  }
+  void process(IppVector const &source, IppVector &dest,
+               SizeType channel = 0) {
+    Private::ippVectorIsEqual(source, dest);
+    process(source.begin(), dest.begin(), source.size(), channel);
+  }
+  void process(std::vector<IppVector> const &sources,
+               std::vector<IppVector> &dests) {
+    if (SizeType(sources.size()) != channels() ||
+        sources.size() != dests.size()) {
+      throw std::invalid_argument("CIppFIR: invalid channels count");
+    }
+    for (SizeType channel{}; channel < channels(); ++channel) {
+      process(sources[channel], dests[channel], channel);
+    }
+  }
+  inline IppVector const &taps() const noexcept { return m_FIRInit.taps(); }
+  inline IppFIRAlgorithm algorithm() const noexcept {
+    return m_FIRInit.algorithm();
+  }
+  inline SizeType blockSize() const noexcept { return m_BlockSize; }
+  inline SizeType channels() const noexcept {
+    return SizeType(m_Delay.size());
+  }
+
+ private:
+  SizeType m_BlockSize{};
+  IppFIRInit m_FIRInit{};
+  std::vector<IppVector> m_Delay{};
+};
+
+using CIppFIR64f = CIppFIR<Ipp64f>;
+using CIppFIR64fc = CIppFIR<Ipp64fc>;
+using CIppFIR32f = CIppFIR<Ipp32f>;
+using CIppFIR32fc = CIppFIR<Ipp32fc>;
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_FIR_HPP
@@ -0,0 +1,99 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_FIR_DESIGN_HPP
+#define IIPPTL_FIR_DESIGN_HPP
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "iipptl_allocator.hpp"
+#include "iipptl_vector.hpp"
+
+namespace IntelIppTL {
+
+// Windowed-sinc lowpass; frequency is normalized to the sample rate and
+// must lie in (0, 0.5). With normalize the DC gain is exactly one.
+inline CIppVector64f ippFIRGenLowpass(double frequency, int tapsSize,
+                                      IppWinType window = ippWinBlackman,
+                                      bool normalize = true) {
+  if (frequency <= 0 || frequency >= 0.5 || tapsSize < 5) {
+    throw std::invalid_argument("ippFIRGenLowpass: invalid argument");
+  }
+  int bufferSize{};
+  IPP_CHECK_STATUS(ippsFIRGenGetBufferSize(tapsSize, &bufferSize));
+  auto buffer{std::unique_ptr<Ipp8u[], decltype(&CIppAllocator::deallocate)>{
+      CIppAllocator::allocate<Ipp8u>(bufferSize), CIppAllocator::deallocate}};
+  auto taps{CIppVector64f(tapsSize)};
+  IPP_CHECK_STATUS(ippsFIRGenLowpass_64f(frequency, taps.begin(), tapsSize,
+                                         window, normalize ? ippTrue : ippFalse,
+                                         buffer.get()));
+  return taps;
+}
+
+// Windowed Hilbert transformer: odd taps 2 / (pi * k) around the center,
+// even taps zero.
+inline CIppVector64f ippFIRGenHilbert(int tapsSize) {
+  if (tapsSize < 3 || tapsSize % 2 == 0) {
+    throw std::invalid_argument("ippFIRGenHilbert: invalid argument");
+  }
+  auto const pi{std::acos(-1.)};
+  auto const center{tapsSize / 2};
+  auto taps{CIppVector64f(tapsSize)};
+  for (int tap{}; tap < tapsSize; ++tap) {
+    auto const k{tap - center};
+    taps[tap] = k % 2 != 0 ? 2 / (pi * k) : 0;
+  }
+  IPP_CHECK_STATUS(ippsWinBlackmanStd_64f_I(taps.begin(), tapsSize));
+  return taps;
+}
+
+// Converts designed 64f taps into the tap type a filter of IppType uses;
+// complex filters get real taps with a zero imaginary part.
+template <typename IppType>
+CIppVector<IppType> ippFIRTaps(CIppVector64f const &taps, double gain = 1) {
+  auto scaled{taps};
+  if (gain != 1) {
+    scaled *= gain;
+  }
+  auto result{CIppVector<IppType>(taps.size())};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    result = scaled;
+  } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    IPP_CHECK_STATUS(ippsRealToCplx_64f(scaled.begin(), nullptr,
+                                        result.begin(), result.size()));
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    IPP_CHECK_STATUS(
+        ippsConvert_64f32f(scaled.begin(), result.begin(), result.size()));
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    auto real{CIppVector32f(taps.size())};
+    IPP_CHECK_STATUS(
+        ippsConvert_64f32f(scaled.begin(), real.begin(), real.size()));
+    IPP_CHECK_STATUS(ippsRealToCplx_32f(real.begin(), nullptr, result.begin(),
+                                        result.size()));
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  return result;
+}
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_FIR_DESIGN_HPP
@@ -0,0 +1,161 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_FIR_INIT_HPP
+#define IIPPTL_FIR_INIT_HPP
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+#include "iipptl_allocator.hpp"
+#include "iipptl_vector.hpp"
+
+namespace IntelIppTL {
+
+enum class IppFIRAlgorithm : int {
+  Auto = ippAlgAuto,
+  Direct = ippAlgDirect,
+  FFT = ippAlgFFT
+};
+
+namespace Detail {
+
+template <typename IppType>
+struct CIppFIRSpec {
+  static constexpr auto pointer() {
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      return static_cast<IppsFIRSpec_64f *>(nullptr);
+    } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+      return static_cast<IppsFIRSpec_64fc *>(nullptr);
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      return static_cast<IppsFIRSpec_32f *>(nullptr);
+    } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+      return static_cast<IppsFIRSpec_32fc *>(nullptr);
+    }
+  }
+  static constexpr IppDataType dataType() {
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      return ipp64f;
+    } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+      return ipp64fc;
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      return ipp32f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+      return ipp32fc;
+    }
+  }
+};
+
+// Short filters and blocks shorter than the filter stay in the time
+// domain; otherwise the FFT overlap-save path wins.
+inline IppFIRAlgorithm ippFIRSelectAlgorithm(int tapsSize, int blockSize) {
+  constexpr int directTapsLimit{32};
+  if (tapsSize <= directTapsLimit || blockSize < tapsSize) {
+    return IppFIRAlgorithm::Direct;
+  }
+  return IppFIRAlgorithm::FFT;
+}
+
+template <typename IppType>
+class CIppFIRInit {
+  using CustomDeleter = std::function<decltype(CIppAllocator::deallocate)>;
+  using UniquePtr = std::unique_ptr<Ipp8u[], CustomDeleter>;
+
+ public:
+  using ValueType = IppType;
+  using IppVector = CIppVector<IppType>;
+  using FIRSpec = decltype(CIppFIRSpec<ValueType>::pointer());
+  using MemBuf = Ipp8u *;
+  using SizeType = typename IppVector::SizeType;
+  CIppFIRInit() = default;
+  CIppFIRInit(IppVector const &taps, SizeType blockSize,
+              IppFIRAlgorithm algorithm = IppFIRAlgorithm::Auto) {
+    reinit(taps, blockSize, algorithm);
+  }
+  CIppFIRInit(CIppFIRInit const &other) { operator=(other); }
+  CIppFIRInit(CIppFIRInit &&) noexcept = default;
+  CIppFIRInit &operator=(CIppFIRInit const &other) {
+    if (this != &other && other.m_pFIRSpec != nullptr) {
+      reinit(other.m_Taps, other.m_BlockSize, other.m_Algorithm);
+    } else if (this != &other) {
+      *this = CIppFIRInit{};
+    }
+    return *this;
+  }
+  CIppFIRInit &operator=(CIppFIRInit &&) noexcept = default;
+  virtual ~CIppFIRInit() noexcept = default;
+  void reinit(IppVector const &taps, SizeType blockSize,
+              IppFIRAlgorithm algorithm = IppFIRAlgorithm::Auto) {
+    if (algorithm == IppFIRAlgorithm::Auto) {
+      algorithm = ippFIRSelectAlgorithm(taps.size(), blockSize);
+    }
+    m_Taps = taps;
+    m_BlockSize = blockSize;
+    m_Algorithm = algorithm;
+    int specSize{}, bufferSize{};
+    IPP_CHECK_STATUS(ippsFIRSRGetSize(
+        taps.size(), CIppFIRSpec<IppType>::dataType(), &specSize,
+        &bufferSize));
+    auto memSpecTmp{UniquePtr{CIppAllocator::allocate<Ipp8u>(specSize),
+                              CIppAllocator::deallocate}};
+    m_MemSpec.swap(memSpecTmp);
+    auto memBufferTmp{UniquePtr{CIppAllocator::allocate<Ipp8u>(bufferSize),
+                                CIppAllocator::deallocate}};
+    m_MemBuffer.swap(memBufferTmp);
+    m_pFIRSpec = reinterpret_cast<FIRSpec>(m_MemSpec.get());
+    std::function<IppStatus(IppType const *, int, IppAlgType, FIRSpec)>
+        ippsFIRSRInit{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      ippsFIRSRInit = ippsFIRSRInit_64f;
+    } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+      ippsFIRSRInit = ippsFIRSRInit_64fc;
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      ippsFIRSRInit = ippsFIRSRInit_32f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+      ippsFIRSRInit = ippsFIRSRInit_32fc;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    IPP_CHECK_STATUS(ippsFIRSRInit(m_Taps.begin(), m_Taps.size(),
+                                   IppAlgType(algorithm), m_pFIRSpec));
+  }
+  inline FIRSpec firSpec() const noexcept { return m_pFIRSpec; }
+  inline MemBuf memBuf() const noexcept { return m_MemBuffer.get(); }
+  inline IppVector const &taps() const noexcept { return m_Taps; }
+  inline IppFIRAlgorithm algorithm() const noexcept { return m_Algorithm; }
+
+ private:
+  FIRSpec m_pFIRSpec{};
+  IppVector m_Taps{};
+  SizeType m_BlockSize{};
+  IppFIRAlgorithm m_Algorithm{IppFIRAlgorithm::Direct};
+  UniquePtr m_MemSpec{};
+  UniquePtr m_MemBuffer{};
+};
+
+using CIppFIRInit64f = CIppFIRInit<Ipp64f>;
+using CIppFIRInit64fc = CIppFIRInit<Ipp64fc>;
+using CIppFIRInit32f = CIppFIRInit<Ipp32f>;
+using CIppFIRInit32fc = CIppFIRInit<Ipp32fc>;
+
+}  // namespace Detail
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_FIR_INIT_HPP
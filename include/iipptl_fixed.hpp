@@ -0,0 +1,284 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_FIXED_HPP
+#define IIPPTL_FIXED_HPP
+
+#include <functional>
+#include <type_traits>
+
+#include "iipptl_vector.hpp"
+
+namespace IntelIppTL {
+
+// Integer arithmetic on 16s/16sc/32s/32sc vectors. Every result is
+// multiplied by 2^-scaleFactor (a negative factor scales up), rounded and
+// saturated, so raw ADC data can stay 16-bit through the early stages of
+// a pipeline.
+
+template <typename IppType>
+void ippAdd(CIppVector<IppType> const &sourceA,
+            CIppVector<IppType> const &sourceB, CIppVector<IppType> &dest,
+            int scaleFactor) {
+  Private::ippVectorIsEqual(sourceA, dest);
+  Private::ippVectorIsEqual(sourceB, dest);
+  std::function<IppStatus(IppType const *, IppType const *, IppType *, int,
+                          int)>
+      ippsAdd{};
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    ippsAdd = ippsAdd_16s_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp16sc>) {
+    ippsAdd = ippsAdd_16sc_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32s>) {
+    ippsAdd = ippsAdd_32s_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32sc>) {
+    ippsAdd = ippsAdd_32sc_Sfs;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsAdd(sourceA.begin(), sourceB.begin(), dest.begin(),
+                           dest.size(), scaleFactor));
+}
+
+template <typename IppType>
+void ippAdd(CIppVector<IppType> const &source, CIppVector<IppType> &vector,
+            int scaleFactor) {
+  Private::ippVectorIsEqual(source, vector);
+  std::function<IppStatus(IppType const *, IppType *, int, int)> ippsAdd{};
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    ippsAdd = ippsAdd_16s_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp16sc>) {
+    ippsAdd = ippsAdd_16sc_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32s>) {
+    ippsAdd = ippsAdd_32s_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32sc>) {
+    ippsAdd = ippsAdd_32sc_ISfs;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsAdd(source.begin(), vector.begin(), vector.size(),
+                           scaleFactor));
+}
+
+// dest = sourceA - sourceB; the in-place form computes vector - source.
+template <typename IppType>
+void ippSub(CIppVector<IppType> const &sourceA,
+            CIppVector<IppType> const &sourceB, CIppVector<IppType> &dest,
+            int scaleFactor) {
+  Private::ippVectorIsEqual(sourceA, dest);
+  Private::ippVectorIsEqual(sourceB, dest);
+  std::function<IppStatus(IppType const *, IppType const *, IppType *, int,
+                          int)>
+      ippsSub{};
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    ippsSub = ippsSub_16s_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp16sc>) {
+    ippsSub = ippsSub_16sc_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32s>) {
+    ippsSub = ippsSub_32s_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32sc>) {
+    ippsSub = ippsSub_32sc_Sfs;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsSub(sourceB.begin(), sourceA.begin(), dest.begin(),
+                           dest.size(), scaleFactor));
+}
+
+template <typename IppType>
+void ippSub(CIppVector<IppType> const &source, CIppVector<IppType> &vector,
+            int scaleFactor) {
+  Private::ippVectorIsEqual(source, vector);
+  std::function<IppStatus(IppType const *, IppType *, int, int)> ippsSub{};
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    ippsSub = ippsSub_16s_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp16sc>) {
+    ippsSub = ippsSub_16sc_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32s>) {
+    ippsSub = ippsSub_32s_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32sc>) {
+    ippsSub = ippsSub_32sc_ISfs;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsSub(source.begin(), vector.begin(), vector.size(),
+                           scaleFactor));
+}
+
+template <typename IppType>
+void ippMul(CIppVector<IppType> const &sourceA,
+            CIppVector<IppType> const &sourceB, CIppVector<IppType> &dest,
+            int scaleFactor) {
+  Private::ippVectorIsEqual(sourceA, dest);
+  Private::ippVectorIsEqual(sourceB, dest);
+  std::function<IppStatus(IppType const *, IppType const *, IppType *, int,
+                          int)>
+      ippsMul{};
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    ippsMul = ippsMul_16s_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp16sc>) {
+    ippsMul = ippsMul_16sc_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32s>) {
+    ippsMul = ippsMul_32s_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32sc>) {
+    ippsMul = ippsMul_32sc_Sfs;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsMul(sourceA.begin(), sourceB.begin(), dest.begin(),
+                           dest.size(), scaleFactor));
+}
+
+template <typename IppType>
+void ippMul(CIppVector<IppType> const &source, CIppVector<IppType> &vector,
+            int scaleFactor) {
+  Private::ippVectorIsEqual(source, vector);
+  std::function<IppStatus(IppType const *, IppType *, int, int)> ippsMul{};
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    ippsMul = ippsMul_16s_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp16sc>) {
+    ippsMul = ippsMul_16sc_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32s>) {
+    ippsMul = ippsMul_32s_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32sc>) {
+    ippsMul = ippsMul_32sc_ISfs;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsMul(source.begin(), vector.begin(), vector.size(),
+                           scaleFactor));
+}
+
+template <typename IppType>
+void ippAddC(CIppVector<IppType> const &source, IppType value,
+             CIppVector<IppType> &dest, int scaleFactor) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(IppType const *, IppType, IppType *, int, int)>
+      ippsAddC{};
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    ippsAddC = ippsAddC_16s_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp16sc>) {
+    ippsAddC = ippsAddC_16sc_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32s>) {
+    ippsAddC = ippsAddC_32s_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32sc>) {
+    ippsAddC = ippsAddC_32sc_Sfs;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsAddC(source.begin(), value, dest.begin(), dest.size(),
+                            scaleFactor));
+}
+
+template <typename IppType>
+void ippAddC(CIppVector<IppType> &vector, IppType value, int scaleFactor) {
+  std::function<IppStatus(IppType, IppType *, int, int)> ippsAddC{};
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    ippsAddC = ippsAddC_16s_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp16sc>) {
+    ippsAddC = ippsAddC_16sc_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32s>) {
+    ippsAddC = ippsAddC_32s_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32sc>) {
+    ippsAddC = ippsAddC_32sc_ISfs;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsAddC(value, vector.begin(), vector.size(), scaleFactor));
+}
+
+// dest = source - value.
+template <typename IppType>
+void ippSubC(CIppVector<IppType> const &source, IppType value,
+             CIppVector<IppType> &dest, int scaleFactor) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(IppType const *, IppType, IppType *, int, int)>
+      ippsSubC{};
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    ippsSubC = ippsSubC_16s_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp16sc>) {
+    ippsSubC = ippsSubC_16sc_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32s>) {
+    ippsSubC = ippsSubC_32s_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32sc>) {
+    ippsSubC = ippsSubC_32sc_Sfs;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsSubC(source.begin(), value, dest.begin(), dest.size(),
+                            scaleFactor));
+}
+
+template <typename IppType>
+void ippSubC(CIppVector<IppType> &vector, IppType value, int scaleFactor) {
+  std::function<IppStatus(IppType, IppType *, int, int)> ippsSubC{};
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    ippsSubC = ippsSubC_16s_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp16sc>) {
+    ippsSubC = ippsSubC_16sc_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32s>) {
+    ippsSubC = ippsSubC_32s_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32sc>) {
+    ippsSubC = ippsSubC_32sc_ISfs;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsSubC(value, vector.begin(), vector.size(), scaleFactor));
+}
+
+template <typename IppType>
+void ippMulC(CIppVector<IppType> const &source, IppType value,
+             CIppVector<IppType> &dest, int scaleFactor) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(IppType const *, IppType, IppType *, int, int)>
+      ippsMulC{};
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    ippsMulC = ippsMulC_16s_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp16sc>) {
+    ippsMulC = ippsMulC_16sc_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32s>) {
+    ippsMulC = ippsMulC_32s_Sfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32sc>) {
+    ippsMulC = ippsMulC_32sc_Sfs;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsMulC(source.begin(), value, dest.begin(), dest.size(),
+                            scaleFactor));
+}
+
+template <typename IppType>
+void ippMulC(CIppVector<IppType> &vector, IppType value, int scaleFactor) {
+  std::function<IppStatus(IppType, IppType *, int, int)> ippsMulC{};
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    ippsMulC = ippsMulC_16s_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp16sc>) {
+    ippsMulC = ippsMulC_16sc_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32s>) {
+    ippsMulC = ippsMulC_32s_ISfs;
+  } else if constexpr (std::is_same_v<IppType, Ipp32sc>) {
+    ippsMulC = ippsMulC_32sc_ISfs;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsMulC(value, vector.begin(), vector.size(), scaleFactor));
+}
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_FIXED_HPP
@@ -0,0 +1,75 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_FLOAT16_HPP
+#define IIPPTL_FLOAT16_HPP
+
+#include <cstring>
+#include <type_traits>
+
+#include "ipp.h"
+
+namespace IntelIppTL {
+
+// 16-bit floating point storage types. IPP declares Ipp16f as Ipp16s, so
+// distinct wrappers keep overloads and CIppVector dispatch unambiguous.
+// Arithmetic is done after conversion to 32f (see iipptl_convert.hpp).
+
+// IEEE 754 binary16.
+struct IppFloat16 {
+  Ipp16u bits;
+};
+
+// bfloat16: the upper half of an IEEE 754 binary32.
+struct IppBFloat16 {
+  Ipp16u bits;
+};
+
+namespace Private {
+
+template <typename IppType>
+inline constexpr bool ippIsFloat16{std::is_same_v<IppType, IppFloat16> ||
+                                   std::is_same_v<IppType, IppBFloat16>};
+
+// Rounds to nearest even; NaNs stay quiet NaNs.
+inline void ippConvertBFloat16(Ipp32f const *source, IppBFloat16 *dest,
+                               int size) {
+  for (int i{}; i < size; ++i) {
+    Ipp32u bits{};
+    std::memcpy(&bits, source + i, sizeof(bits));
+    if ((bits & 0x7FFFFFFF) > 0x7F800000) {
+      dest[i].bits = Ipp16u(bits >> 16 | 0x40);
+    } else {
+      dest[i].bits = Ipp16u((bits + 0x7FFF + (bits >> 16 & 1)) >> 16);
+    }
+  }
+}
+
+inline void ippConvertBFloat16(IppBFloat16 const *source, Ipp32f *dest,
+                               int size) {
+  for (int i{}; i < size; ++i) {
+    auto const bits{Ipp32u(source[i].bits) << 16};
+    std::memcpy(dest + i, &bits, sizeof(bits));
+  }
+}
+
+}  // namespace Private
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_FLOAT16_HPP
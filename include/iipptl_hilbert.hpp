@@ -0,0 +1,93 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_HILBERT_HPP
+#define IIPPTL_HILBERT_HPP
+
+#include <stdexcept>
+
+#include "iipptl_fir.hpp"
+#include "iipptl_fir_design.hpp"
+#include "iipptl_vector.hpp"
+
+namespace IntelIppTL {
+
+// Streaming real-to-analytic converter. The imaginary part is the Hilbert
+// FIR output and the real part is the input delayed by the FIR group delay,
+// so only one real filter runs per sample and no negative-frequency half
+// is ever computed. Block boundaries are seamless.
+class CIppHilbert {
+ public:
+  using ValueType = Ipp32fc;
+  using IppVector = CIppVector<Ipp32fc>;
+  using SizeType = typename IppVector::SizeType;
+  CIppHilbert() = default;
+  CIppHilbert(SizeType blockSize, SizeType tapsSize = 127)
+      : m_BlockSize{blockSize},
+        m_GroupDelay{tapsSize / 2},
+        m_Filter{ippFIRTaps<Ipp32f>(ippFIRGenHilbert(tapsSize)), blockSize},
+        m_History(tapsSize / 2 + blockSize),
+        m_Imag(blockSize) {
+    if (blockSize <= 0) {
+      throw std::invalid_argument("CIppHilbert: invalid ctor argument");
+    }
+    reset();
+  }
+  CIppHilbert(CIppHilbert const &) = default;
+  CIppHilbert(CIppHilbert &&) noexcept = default;
+  CIppHilbert &operator=(CIppHilbert const &) = default;
+  CIppHilbert &operator=(CIppHilbert &&) noexcept = default;
+  virtual ~CIppHilbert() noexcept = default;
+  void reset() {
+    m_Filter.reset();
+    m_History = 0;
+  }
+  void process(Ipp32f const *source, Ipp32fc *dest, SizeType size) {
+    if (size < 0 || size > m_BlockSize) {
+      throw std::out_of_range("CIppHilbert: block size out of range");
+    }
+    if (size == 0) {
+      return;
+    }
+    auto *history{m_History.begin()};
+    IPP_CHECK_STATUS(ippsCopy_32f(source, history + m_GroupDelay, size));
+    m_Filter.process(source, m_Imag.begin(), size);
+    IPP_CHECK_STATUS(ippsRealToCplx_32f(history, m_Imag.begin(), dest, size));
+    if (m_GroupDelay > 0) {
+      IPP_CHECK_STATUS(ippsMove_32f(history + size, history, m_GroupDelay));
+    }
+  }
+  void process(CIppVector32f const &source, IppVector &dest) {
+    Private::ippVectorIsEqual(source, dest);
+    process(source.begin(), dest.begin(), source.size());
+  }
+  // Delay of the output relative to the input, in samples.
+  inline SizeType groupDelay() const noexcept { return m_GroupDelay; }
+  inline SizeType blockSize() const noexcept { return m_BlockSize; }
+
+ private:
+  SizeType m_BlockSize{};
+  SizeType m_GroupDelay{};
+  CIppFIR32f m_Filter{};
+  CIppVector32f m_History{};
+  CIppVector32f m_Imag{};
+};
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_HILBERT_HPP
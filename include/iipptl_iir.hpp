@@ -0,0 +1,211 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_IIR_HPP
+#define IIPPTL_IIR_HPP
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "iipptl_allocator.hpp"
+#include "iipptl_fir_design.hpp"
+#include "iipptl_iir_design.hpp"
+#include "iipptl_vector.hpp"
+
+namespace IntelIppTL {
+
+namespace Detail {
+
+template <typename IppType>
+struct CIppIIRState {
+  static constexpr auto pointer() {
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      return static_cast<IppsIIRState_64f *>(nullptr);
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      return static_cast<IppsIIRState_32f *>(nullptr);
+    } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+      return static_cast<IppsIIRState_32fc *>(nullptr);
+    }
+  }
+};
+
+}  // namespace Detail
+
+// Cascade of biquad sections; taps hold six values per section in the
+// order b0 b1 b2 a0 a1 a2 (see ippIIRButterworth/ippIIRChebyshev1). Each
+// channel owns an IPP state, so its delay line survives between blocks.
+template <typename IppType>
+class CIppIIR {
+  using CustomDeleter = std::function<decltype(CIppAllocator::deallocate)>;
+  using UniquePtr = std::unique_ptr<Ipp8u[], CustomDeleter>;
+
+ public:
+  using ValueType = IppType;
+  using IppVector = CIppVector<IppType>;
+  using SizeType = typename IppVector::SizeType;
+  using IIRState = decltype(Detail::CIppIIRState<IppType>::pointer());
+  CIppIIR() = default;
+  CIppIIR(IppVector const &taps, SizeType channels = 1) {
+    if (taps.size() <= 0 || taps.size() % Private::k_BiQuadTaps != 0 ||
+        channels <= 0) {
+      throw std::invalid_argument("CIppIIR: invalid ctor argument");
+    }
+    m_Taps = taps;
+    m_MemState.resize(channels);
+    m_pIIRState.resize(channels);
+    reset();
+  }
+  // Takes the 64f taps of the design helpers directly.
+  template <typename T = IppType,
+            typename = std::enable_if_t<!std::is_same_v<T, Ipp64f>>>
+  CIppIIR(CIppVector64f const &taps, SizeType channels = 1)
+      : CIppIIR(ippFIRTaps<IppType>(taps), channels) {}
+  CIppIIR(CIppIIR const &other) { operator=(other); }
+  CIppIIR(CIppIIR &&) noexcept = default;
+  CIppIIR &operator=(CIppIIR const &other) {
+    if (this != &other && other.channels() > 0) {
+      auto tmp{CIppIIR(other.m_Taps, other.channels())};
+      for (SizeType channel{}; channel < tmp.channels(); ++channel) {
+        auto delay{IppVector(2 * other.sections())};
+        other.getDelay(channel, delay.begin());
+        tmp.init(channel, delay.begin());
+      }
+      std::swap(*this, tmp);
+    } else if (this != &other) {
+      *this = CIppIIR{};
+    }
+    return *this;
+  }
+  CIppIIR &operator=(CIppIIR &&) noexcept = default;
+  virtual ~CIppIIR() noexcept = default;
+  void reset() {
+    for (SizeType channel{}; channel < channels(); ++channel) {
+      init(channel, nullptr);
+    }
+  }
+  void process(IppType const *source, IppType *dest, SizeType size,
+               SizeType channel = 0) {
+    std::function<IppStatus(IppType const *, IppType *, int, IIRState)>
+        ippsIIR{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      ippsIIR = ippsIIR_64f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      ippsIIR = ippsIIR_32f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+      ippsIIR = ippsIIR_32fc;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    if (size > 0) {
+      IPP_CHECK_STATUS(ippsIIR(source, dest, size, m_pIIRState.at(channel)));
+    }
+  }
+  void process(IppVector const &source, IppVector &dest,
+               SizeType channel = 0) {
+    Private::ippVectorIsEqual(source, dest);
+    process(source.begin(), dest.begin(), source.size(), channel);
+  }
+  void process(IppVector &vector, SizeType channel = 0) {
+    std::function<IppStatus(IppType *, int, IIRState)> ippsIIR{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      ippsIIR = ippsIIR_64f_I;
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      ippsIIR = ippsIIR_32f_I;
+    } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+      ippsIIR = ippsIIR_32fc_I;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    IPP_CHECK_STATUS(
+        ippsIIR(vector.begin(), vector.size(), m_pIIRState.at(channel)));
+  }
+  void process(std::vector<IppVector> const &sources,
+               std::vector<IppVector> &dests) {
+    if (SizeType(sources.size()) != channels() ||
+        sources.size() != dests.size()) {
+      throw std::invalid_argument("CIppIIR: invalid channels count");
+    }
+    for (SizeType channel{}; channel < channels(); ++channel) {
+      process(sources[channel], dests[channel], channel);
+    }
+  }
+  inline IppVector const &taps() const noexcept { return m_Taps; }
+  inline SizeType sections() const noexcept {
+    return m_Taps.size() / Private::k_BiQuadTaps;
+  }
+  inline SizeType channels() const noexcept {
+    return SizeType(m_pIIRState.size());
+  }
+
+ private:
+  void init(SizeType channel, IppType const *delay) {
+    std::function<IppStatus(int, int *)> ippsIIRGetStateSize{};
+    std::function<IppStatus(IIRState *, IppType const *, int, IppType const *,
+                            Ipp8u *)>
+        ippsIIRInit{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      ippsIIRGetStateSize = ippsIIRGetStateSize_BiQuad_64f;
+      ippsIIRInit = ippsIIRInit_BiQuad_64f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      ippsIIRGetStateSize = ippsIIRGetStateSize_BiQuad_32f;
+      ippsIIRInit = ippsIIRInit_BiQuad_32f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+      ippsIIRGetStateSize = ippsIIRGetStateSize_BiQuad_32fc;
+      ippsIIRInit = ippsIIRInit_BiQuad_32fc;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    auto &memState{m_MemState[channel]};
+    if (!memState) {
+      int stateSize{};
+      IPP_CHECK_STATUS(ippsIIRGetStateSize(sections(), &stateSize));
+      memState = UniquePtr{CIppAllocator::allocate<Ipp8u>(stateSize),
+                           CIppAllocator::deallocate};
+    }
+    IPP_CHECK_STATUS(ippsIIRInit(&m_pIIRState[channel], m_Taps.begin(),
+                                 sections(), delay, memState.get()));
+  }
+  void getDelay(SizeType channel, IppType *delay) const {
+    std::function<IppStatus(IIRState, IppType *)> ippsIIRGetDlyLine{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      ippsIIRGetDlyLine = ippsIIRGetDlyLine_64f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      ippsIIRGetDlyLine = ippsIIRGetDlyLine_32f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+      ippsIIRGetDlyLine = ippsIIRGetDlyLine_32fc;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    IPP_CHECK_STATUS(ippsIIRGetDlyLine(m_pIIRState[channel], delay));
+  }
+
+  IppVector m_Taps{};
+  std::vector<UniquePtr> m_MemState{};
+  std::vector<IIRState> m_pIIRState{};
+};
+
+using CIppIIR64f = CIppIIR<Ipp64f>;
+using CIppIIR32f = CIppIIR<Ipp32f>;
+using CIppIIR32fc = CIppIIR<Ipp32fc>;
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_IIR_HPP
@@ -0,0 +1,143 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_IIR_DESIGN_HPP
+#define IIPPTL_IIR_DESIGN_HPP
+
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <vector>
+
+#include "iipptl_vector.hpp"
+
+namespace IntelIppTL {
+
+enum class IppIIRType { Lowpass, Highpass };
+
+namespace Private {
+
+inline constexpr int k_BiQuadTaps{6};
+
+// Bilinear transform of one analog prototype pole (or conjugate pair) into
+// a biquad laid out as IPP expects: b0 b1 b2 a0 a1 a2. The prototype is
+// normalized to 1 rad/s and warped onto the digital cutoff.
+inline void ippIIRBiQuad(std::complex<double> pole, double warped,
+                         IppIIRType type, double *taps) {
+  auto const real{std::abs(pole.imag()) < 1e-12};
+  auto const section{type == IppIIRType::Lowpass ? warped * pole
+                                                 : warped / pole};
+  if (real) {
+    auto const a{section.real()};
+    double const a0{1 - a};
+    if (type == IppIIRType::Lowpass) {
+      taps[0] = -a / a0;
+      taps[1] = -a / a0;
+    } else {
+      taps[0] = 1 / a0;
+      taps[1] = -1 / a0;
+    }
+    taps[2] = 0;
+    taps[3] = 1;
+    taps[4] = (-1 - a) / a0;
+    taps[5] = 0;
+    return;
+  }
+  auto const twiceReal{2 * section.real()};
+  auto const norm{std::norm(section)};
+  auto const a0{1 - twiceReal + norm};
+  if (type == IppIIRType::Lowpass) {
+    taps[0] = norm / a0;
+    taps[1] = 2 * norm / a0;
+    taps[2] = norm / a0;
+  } else {
+    taps[0] = 1 / a0;
+    taps[1] = -2 / a0;
+    taps[2] = 1 / a0;
+  }
+  taps[3] = 1;
+  taps[4] = (2 * norm - 2) / a0;
+  taps[5] = (1 + twiceReal + norm) / a0;
+}
+
+inline CIppVector64f ippIIRBiQuads(
+    std::vector<std::complex<double>> const &poles, double frequency,
+    IppIIRType type, double gain) {
+  auto const warped{std::tan(std::acos(-1.) * frequency)};
+  auto const sections{int(poles.size())};
+  auto taps{CIppVector64f(sections * k_BiQuadTaps)};
+  for (int section{}; section < sections; ++section) {
+    ippIIRBiQuad(poles[section], warped, type,
+                 taps.begin() + section * k_BiQuadTaps);
+  }
+  for (int tap{}; tap < 3; ++tap) {
+    taps[tap] *= gain;
+  }
+  return taps;
+}
+
+inline void ippIIRCheck(int order, double frequency) {
+  if (order <= 0 || frequency <= 0 || frequency >= 0.5) {
+    throw std::invalid_argument("ippIIRDesign: invalid argument");
+  }
+}
+
+}  // namespace Private
+
+// Butterworth biquad cascade; frequency is the -3 dB point normalized to
+// the sample rate. Returns (order + 1) / 2 sections of six taps each.
+inline CIppVector64f ippIIRButterworth(int order, double frequency,
+                                       IppIIRType type = IppIIRType::Lowpass) {
+  Private::ippIIRCheck(order, frequency);
+  auto const pi{std::acos(-1.)};
+  std::vector<std::complex<double>> poles{};
+  for (int k{}; k < order / 2; ++k) {
+    poles.push_back(std::polar(1., pi * (2 * k + order + 1) / (2 * order)));
+  }
+  if (order % 2 != 0) {
+    poles.emplace_back(-1, 0);
+  }
+  return Private::ippIIRBiQuads(poles, frequency, type, 1);
+}
+
+// Chebyshev type I biquad cascade with the given passband ripple in dB;
+// frequency is the passband edge normalized to the sample rate.
+inline CIppVector64f ippIIRChebyshev1(int order, double frequency,
+                                      double ripple,
+                                      IppIIRType type = IppIIRType::Lowpass) {
+  Private::ippIIRCheck(order, frequency);
+  if (ripple <= 0) {
+    throw std::invalid_argument("ippIIRDesign: invalid argument");
+  }
+  auto const pi{std::acos(-1.)};
+  auto const epsilon{std::sqrt(std::pow(10., ripple / 10) - 1)};
+  auto const mu{std::asinh(1 / epsilon) / order};
+  std::vector<std::complex<double>> poles{};
+  for (int k{}; k < (order + 1) / 2; ++k) {
+    auto const theta{pi * (2 * k + 1) / (2 * order)};
+    poles.emplace_back(-std::sinh(mu) * std::sin(theta),
+                       std::cosh(mu) * std::cos(theta));
+  }
+  // Even orders start the passband at the bottom of the ripple.
+  auto const gain{order % 2 == 0 ? 1 / std::sqrt(1 + epsilon * epsilon) : 1.};
+  return Private::ippIIRBiQuads(poles, frequency, type, gain);
+}
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_IIR_DESIGN_HPP
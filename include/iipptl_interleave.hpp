@@ -0,0 +1,228 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_INTERLEAVE_HPP
+#define IIPPTL_INTERLEAVE_HPP
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "iipptl_vector.hpp"
+
+namespace IntelIppTL {
+
+namespace Private {
+
+// Interleaved samples converted per pass by the fused kernels.
+inline constexpr int k_InterleaveChunkSize{4096};
+// Frames per block of the generic kernels, so the interleaved block stays
+// in L1 while every channel is gathered from it.
+inline constexpr int k_InterleaveBlockSize{256};
+
+// 16sc is moved as one 32-bit word; 32fc has no IPP kernel and goes
+// through a blocked loop.
+template <typename IppType>
+void ippDeinterleave(IppType const *source, int channels, int size,
+                     IppType *const *dest) {
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    IPP_CHECK_STATUS(ippsDeinterleave_16s(source, channels, size,
+                                          const_cast<Ipp16s **>(dest)));
+  } else if constexpr (std::is_same_v<IppType, Ipp32f> ||
+                       std::is_same_v<IppType, Ipp16sc>) {
+    IPP_CHECK_STATUS(ippsDeinterleave_32f(
+        reinterpret_cast<Ipp32f const *>(source), channels, size,
+        reinterpret_cast<Ipp32f **>(const_cast<IppType **>(dest))));
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    for (int block{}; block < size; block += k_InterleaveBlockSize) {
+      auto const end{std::min(size, block + k_InterleaveBlockSize)};
+      for (int channel{}; channel < channels; ++channel) {
+        auto const *frame{source + block * channels + channel};
+        for (int sample{block}; sample < end; ++sample, frame += channels) {
+          dest[channel][sample] = *frame;
+        }
+      }
+    }
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+}
+
+template <typename IppType>
+void ippInterleave(IppType const *const *source, int channels, int size,
+                   IppType *dest) {
+  if constexpr (std::is_same_v<IppType, Ipp16s>) {
+    IPP_CHECK_STATUS(ippsInterleave_16s(const_cast<Ipp16s const **>(source),
+                                        channels, size, dest));
+  } else if constexpr (std::is_same_v<IppType, Ipp32f> ||
+                       std::is_same_v<IppType, Ipp16sc>) {
+    IPP_CHECK_STATUS(ippsInterleave_32f(
+        reinterpret_cast<Ipp32f const **>(const_cast<IppType const **>(source)),
+        channels, size, reinterpret_cast<Ipp32f *>(dest)));
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    for (int block{}; block < size; block += k_InterleaveBlockSize) {
+      auto const end{std::min(size, block + k_InterleaveBlockSize)};
+      for (int channel{}; channel < channels; ++channel) {
+        auto *frame{dest + block * channels + channel};
+        for (int sample{block}; sample < end; ++sample, frame += channels) {
+          *frame = source[channel][sample];
+        }
+      }
+    }
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+}
+
+template <typename IppType>
+int ippChannelSize(CIppVector<IppType> const &source, int channels,
+                   int channelSize) {
+  if (channels <= 0 || source.size() != channels * channelSize) {
+    throw std::invalid_argument("ippInterleave: invalid channels count");
+  }
+  return channelSize;
+}
+
+template <typename IppType>
+std::vector<IppType *> ippChannelPointers(
+    std::vector<CIppVector<IppType>> &channels) {
+  std::vector<IppType *> pointers{};
+  for (auto &channel : channels) {
+    if (channel.size() != channels.front().size()) {
+      throw std::invalid_argument("ippInterleave: channel size mismatch");
+    }
+    pointers.push_back(channel.begin());
+  }
+  return pointers;
+}
+
+template <typename IppType>
+std::vector<IppType const *> ippChannelPointers(
+    std::vector<CIppVector<IppType>> const &channels) {
+  std::vector<IppType const *> pointers{};
+  for (auto const &channel : channels) {
+    if (channel.size() != channels.front().size()) {
+      throw std::invalid_argument("ippInterleave: channel size mismatch");
+    }
+    pointers.push_back(channel.begin());
+  }
+  return pointers;
+}
+
+}  // namespace Private
+
+// Splits frames of channels.size() samples into one vector per channel.
+template <typename IppType>
+void ippDeinterleave(CIppVector<IppType> const &source,
+                     std::vector<CIppVector<IppType>> &dest) {
+  auto const pointers{Private::ippChannelPointers(dest)};
+  auto const channels{int(pointers.size())};
+  auto const size{Private::ippChannelSize(
+      source, channels, channels > 0 ? dest.front().size() : 0)};
+  Private::ippDeinterleave(source.begin(), channels, size, pointers.data());
+}
+
+// Channel-major variant: channel k lands at dest.begin() + k * size.
+template <typename IppType>
+void ippDeinterleave(CIppVector<IppType> const &source, int channels,
+                     CIppVector<IppType> &dest) {
+  Private::ippVectorIsEqual(source, dest);
+  auto const size{channels > 0 ? source.size() / channels : 0};
+  Private::ippChannelSize(source, channels, size);
+  std::vector<IppType *> pointers{};
+  for (int channel{}; channel < channels; ++channel) {
+    pointers.push_back(dest.begin() + channel * size);
+  }
+  Private::ippDeinterleave(source.begin(), channels, size, pointers.data());
+}
+
+template <typename IppType>
+void ippInterleave(std::vector<CIppVector<IppType>> const &source,
+                   CIppVector<IppType> &dest) {
+  auto const pointers{Private::ippChannelPointers(source)};
+  auto const channels{int(pointers.size())};
+  auto const size{Private::ippChannelSize(
+      dest, channels, channels > 0 ? source.front().size() : 0)};
+  Private::ippInterleave(pointers.data(), channels, size, dest.begin());
+}
+
+template <typename IppType>
+void ippInterleave(CIppVector<IppType> const &source, int channels,
+                   CIppVector<IppType> &dest) {
+  Private::ippVectorIsEqual(source, dest);
+  auto const size{channels > 0 ? source.size() / channels : 0};
+  Private::ippChannelSize(source, channels, size);
+  std::vector<IppType const *> pointers{};
+  for (int channel{}; channel < channels; ++channel) {
+    pointers.push_back(source.begin() + channel * size);
+  }
+  Private::ippInterleave(pointers.data(), channels, size, dest.begin());
+}
+
+namespace Private {
+
+// Converts a chunk of whole frames to float while it is in L1, scales it
+// and splits it into the channel vectors.
+template <typename IppType, typename FloatType>
+void ippDeinterleaveFloat(CIppVector<IppType> const &source,
+                          std::vector<CIppVector<FloatType>> &dest,
+                          Ipp32f gain) {
+  constexpr auto components{ippComponents<FloatType>};
+  auto pointers{ippChannelPointers(dest)};
+  auto const channels{int(pointers.size())};
+  auto const size{
+      ippChannelSize(source, channels, channels > 0 ? dest.front().size() : 0)};
+  auto const frames{std::max(1, k_InterleaveChunkSize / channels)};
+  std::vector<FloatType> chunk(std::min(size, frames) * channels);
+  auto const *raw{reinterpret_cast<Ipp16s const *>(source.begin())};
+  auto *real{reinterpret_cast<Ipp32f *>(chunk.data())};
+  for (int frame{}; frame < size; frame += frames) {
+    auto const length{std::min(frames, size - frame)};
+    auto const samples{length * channels * components};
+    IPP_CHECK_STATUS(ippsConvert_16s32f(
+        raw + frame * channels * components, real, samples));
+    if (gain != 1) {
+      IPP_CHECK_STATUS(ippsMulC_32f_I(gain, real, samples));
+    }
+    ippDeinterleave(chunk.data(), channels, length, pointers.data());
+    for (auto &pointer : pointers) {
+      pointer += length;
+    }
+  }
+}
+
+}  // namespace Private
+
+// Fused split of interleaved 16-bit samples into scaled float channels.
+inline void ippDeinterleave(CIppVector<Ipp16s> const &source,
+                            std::vector<CIppVector<Ipp32f>> &dest,
+                            Ipp32f gain = 1) {
+  Private::ippDeinterleaveFloat(source, dest, gain);
+}
+
+inline void ippDeinterleave(CIppVector<Ipp16sc> const &source,
+                            std::vector<CIppVector<Ipp32fc>> &dest,
+                            Ipp32f gain = 1) {
+  Private::ippDeinterleaveFloat(source, dest, gain);
+}
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_INTERLEAVE_HPP
@@ -19,6 +19,10 @@
 #ifndef IIPPTL_MATH_HPP
 #define IIPPTL_MATH_HPP
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 #include "iipptl_accuracy.hpp"
 #include "iipptl_vector.hpp"
 
@@ -197,6 +201,410 @@ void ippAtan2(CIppVector64f const &sourceRe, CIppVector64f const &sourceIm,
       ippsAtan2(sourceRe.begin(), sourceIm.begin(), dest.begin(), dest.size()));
 }
 
+namespace Private {
+
+template <auto const accuracy, typename Function>
+Function ippAccuracySelect(Function low, Function medium, Function high) {
+  using Accuracy = decltype(accuracy);
+  if constexpr (std::is_same_v<Accuracy, AccuracyLevels::SinglePrecision>) {
+    if constexpr (accuracy == AccuracyLevels::SinglePrecision::A11) {
+      return low;
+    } else if constexpr (accuracy == AccuracyLevels::SinglePrecision::A21) {
+      return medium;
+    } else {
+      return high;
+    }
+  } else {
+    if constexpr (accuracy == AccuracyLevels::DoublePrecision::A26) {
+      return low;
+    } else if constexpr (accuracy == AccuracyLevels::DoublePrecision::A50) {
+      return medium;
+    } else {
+      return high;
+    }
+  }
+}
+
+}  // namespace Private
+
+template <AccuracyLevels::SinglePrecision const accuracy =
+              AccuracyLevels::SinglePrecision::A11,
+          typename IppType>
+void ippExp(CIppVector<IppType> const &source, CIppVector<IppType> &dest,
+            std::enable_if_t<std::is_same_v<IppType, Ipp32f> ||
+                                 std::is_same_v<IppType, Ipp32fc>,
+                             int> = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsExp{};
+  if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsExp = Private::ippAccuracySelect<accuracy>(
+        ippsExp_32f_A11, ippsExp_32f_A21, ippsExp_32f_A24);
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsExp = Private::ippAccuracySelect<accuracy>(
+        ippsExp_32fc_A11, ippsExp_32fc_A21, ippsExp_32fc_A24);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsExp(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::DoublePrecision const accuracy =
+              AccuracyLevels::DoublePrecision::A26,
+          typename IppType>
+void ippExp(CIppVector<IppType> const &source, CIppVector<IppType> &dest,
+            std::enable_if_t<std::is_same_v<IppType, Ipp64f> ||
+                                 std::is_same_v<IppType, Ipp64fc>,
+                             int> = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsExp{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsExp = Private::ippAccuracySelect<accuracy>(
+        ippsExp_64f_A26, ippsExp_64f_A50, ippsExp_64f_A53);
+  } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsExp = Private::ippAccuracySelect<accuracy>(
+        ippsExp_64fc_A26, ippsExp_64fc_A50, ippsExp_64fc_A53);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsExp(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::SinglePrecision const accuracy =
+              AccuracyLevels::SinglePrecision::A11,
+          typename IppType>
+void ippSin(CIppVector<IppType> const &source, CIppVector<IppType> &dest,
+            std::enable_if_t<std::is_same_v<IppType, Ipp32f> ||
+                                 std::is_same_v<IppType, Ipp32fc>,
+                             int> = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsSin{};
+  if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsSin = Private::ippAccuracySelect<accuracy>(
+        ippsSin_32f_A11, ippsSin_32f_A21, ippsSin_32f_A24);
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsSin = Private::ippAccuracySelect<accuracy>(
+        ippsSin_32fc_A11, ippsSin_32fc_A21, ippsSin_32fc_A24);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsSin(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::DoublePrecision const accuracy =
+              AccuracyLevels::DoublePrecision::A26,
+          typename IppType>
+void ippSin(CIppVector<IppType> const &source, CIppVector<IppType> &dest,
+            std::enable_if_t<std::is_same_v<IppType, Ipp64f> ||
+                                 std::is_same_v<IppType, Ipp64fc>,
+                             int> = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsSin{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsSin = Private::ippAccuracySelect<accuracy>(
+        ippsSin_64f_A26, ippsSin_64f_A50, ippsSin_64f_A53);
+  } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsSin = Private::ippAccuracySelect<accuracy>(
+        ippsSin_64fc_A26, ippsSin_64fc_A50, ippsSin_64fc_A53);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsSin(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::SinglePrecision const accuracy =
+              AccuracyLevels::SinglePrecision::A11,
+          typename IppType>
+void ippCos(CIppVector<IppType> const &source, CIppVector<IppType> &dest,
+            std::enable_if_t<std::is_same_v<IppType, Ipp32f> ||
+                                 std::is_same_v<IppType, Ipp32fc>,
+                             int> = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsCos{};
+  if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsCos = Private::ippAccuracySelect<accuracy>(
+        ippsCos_32f_A11, ippsCos_32f_A21, ippsCos_32f_A24);
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsCos = Private::ippAccuracySelect<accuracy>(
+        ippsCos_32fc_A11, ippsCos_32fc_A21, ippsCos_32fc_A24);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsCos(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::DoublePrecision const accuracy =
+              AccuracyLevels::DoublePrecision::A26,
+          typename IppType>
+void ippCos(CIppVector<IppType> const &source, CIppVector<IppType> &dest,
+            std::enable_if_t<std::is_same_v<IppType, Ipp64f> ||
+                                 std::is_same_v<IppType, Ipp64fc>,
+                             int> = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsCos{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsCos = Private::ippAccuracySelect<accuracy>(
+        ippsCos_64f_A26, ippsCos_64f_A50, ippsCos_64f_A53);
+  } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsCos = Private::ippAccuracySelect<accuracy>(
+        ippsCos_64fc_A26, ippsCos_64fc_A50, ippsCos_64fc_A53);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsCos(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::SinglePrecision const accuracy =
+              AccuracyLevels::SinglePrecision::A11,
+          typename IppType>
+void ippTan(CIppVector<IppType> const &source, CIppVector<IppType> &dest,
+            std::enable_if_t<std::is_same_v<IppType, Ipp32f> ||
+                                 std::is_same_v<IppType, Ipp32fc>,
+                             int> = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsTan{};
+  if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsTan = Private::ippAccuracySelect<accuracy>(
+        ippsTan_32f_A11, ippsTan_32f_A21, ippsTan_32f_A24);
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsTan = Private::ippAccuracySelect<accuracy>(
+        ippsTan_32fc_A11, ippsTan_32fc_A21, ippsTan_32fc_A24);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsTan(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::DoublePrecision const accuracy =
+              AccuracyLevels::DoublePrecision::A26,
+          typename IppType>
+void ippTan(CIppVector<IppType> const &source, CIppVector<IppType> &dest,
+            std::enable_if_t<std::is_same_v<IppType, Ipp64f> ||
+                                 std::is_same_v<IppType, Ipp64fc>,
+                             int> = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsTan{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsTan = Private::ippAccuracySelect<accuracy>(
+        ippsTan_64f_A26, ippsTan_64f_A50, ippsTan_64f_A53);
+  } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsTan = Private::ippAccuracySelect<accuracy>(
+        ippsTan_64fc_A26, ippsTan_64fc_A50, ippsTan_64fc_A53);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsTan(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::SinglePrecision const accuracy =
+              AccuracyLevels::SinglePrecision::A11,
+          typename IppType>
+void ippPow(CIppVector<IppType> const &sourceA,
+            CIppVector<IppType> const &sourceB, CIppVector<IppType> &dest,
+            std::enable_if_t<std::is_same_v<IppType, Ipp32f> ||
+                                 std::is_same_v<IppType, Ipp32fc>,
+                             int> = 0) {
+  Private::ippVectorIsEqual(sourceA, dest);
+  Private::ippVectorIsEqual(sourceB, dest);
+  std::function<IppStatus(IppType const *, IppType const *, IppType *, int)>
+      ippsPow{};
+  if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsPow = Private::ippAccuracySelect<accuracy>(
+        ippsPow_32f_A11, ippsPow_32f_A21, ippsPow_32f_A24);
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsPow = Private::ippAccuracySelect<accuracy>(
+        ippsPow_32fc_A11, ippsPow_32fc_A21, ippsPow_32fc_A24);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsPow(sourceA.begin(), sourceB.begin(), dest.begin(),
+                           dest.size()));
+}
+
+template <AccuracyLevels::DoublePrecision const accuracy =
+              AccuracyLevels::DoublePrecision::A26,
+          typename IppType>
+void ippPow(CIppVector<IppType> const &sourceA,
+            CIppVector<IppType> const &sourceB, CIppVector<IppType> &dest,
+            std::enable_if_t<std::is_same_v<IppType, Ipp64f> ||
+                                 std::is_same_v<IppType, Ipp64fc>,
+                             int> = 0) {
+  Private::ippVectorIsEqual(sourceA, dest);
+  Private::ippVectorIsEqual(sourceB, dest);
+  std::function<IppStatus(IppType const *, IppType const *, IppType *, int)>
+      ippsPow{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsPow = Private::ippAccuracySelect<accuracy>(
+        ippsPow_64f_A26, ippsPow_64f_A50, ippsPow_64f_A53);
+  } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsPow = Private::ippAccuracySelect<accuracy>(
+        ippsPow_64fc_A26, ippsPow_64fc_A50, ippsPow_64fc_A53);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsPow(sourceA.begin(), sourceB.begin(), dest.begin(),
+                           dest.size()));
+}
+
+template <AccuracyLevels::SinglePrecision const accuracy =
+              AccuracyLevels::SinglePrecision::A11,
+          typename IppType>
+void ippPowx(CIppVector<IppType> const &source, IppType value,
+             CIppVector<IppType> &dest,
+             std::enable_if_t<std::is_same_v<IppType, Ipp32f> ||
+                                  std::is_same_v<IppType, Ipp32fc>,
+                              int> = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(IppType const *, IppType, IppType *, int)> ippsPowx{};
+  if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsPowx = Private::ippAccuracySelect<accuracy>(
+        ippsPowx_32f_A11, ippsPowx_32f_A21, ippsPowx_32f_A24);
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsPowx = Private::ippAccuracySelect<accuracy>(
+        ippsPowx_32fc_A11, ippsPowx_32fc_A21, ippsPowx_32fc_A24);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsPowx(source.begin(), value, dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::DoublePrecision const accuracy =
+              AccuracyLevels::DoublePrecision::A26,
+          typename IppType>
+void ippPowx(CIppVector<IppType> const &source, IppType value,
+             CIppVector<IppType> &dest,
+             std::enable_if_t<std::is_same_v<IppType, Ipp64f> ||
+                                  std::is_same_v<IppType, Ipp64fc>,
+                              int> = 0) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(IppType const *, IppType, IppType *, int)> ippsPowx{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsPowx = Private::ippAccuracySelect<accuracy>(
+        ippsPowx_64f_A26, ippsPowx_64f_A50, ippsPowx_64f_A53);
+  } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsPowx = Private::ippAccuracySelect<accuracy>(
+        ippsPowx_64fc_A26, ippsPowx_64fc_A50, ippsPowx_64fc_A53);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsPowx(source.begin(), value, dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::SinglePrecision accuracy =
+              AccuracyLevels::SinglePrecision::A11>
+void ippSinCos(CIppVector32f const &source, CIppVector32f &destSin,
+               CIppVector32f &destCos) {
+  Private::ippVectorIsEqual(source, destSin);
+  Private::ippVectorIsEqual(source, destCos);
+  std::function<IppStatus(Ipp32f const *, Ipp32f *, Ipp32f *, int)>
+      ippsSinCos{};
+  ippsSinCos = Private::ippAccuracySelect<accuracy>(
+      ippsSinCos_32f_A11, ippsSinCos_32f_A21, ippsSinCos_32f_A24);
+  IPP_CHECK_STATUS(ippsSinCos(source.begin(), destSin.begin(), destCos.begin(),
+                              source.size()));
+}
+
+template <AccuracyLevels::DoublePrecision accuracy =
+              AccuracyLevels::DoublePrecision::A26>
+void ippSinCos(CIppVector64f const &source, CIppVector64f &destSin,
+               CIppVector64f &destCos) {
+  Private::ippVectorIsEqual(source, destSin);
+  Private::ippVectorIsEqual(source, destCos);
+  std::function<IppStatus(Ipp64f const *, Ipp64f *, Ipp64f *, int)>
+      ippsSinCos{};
+  ippsSinCos = Private::ippAccuracySelect<accuracy>(
+      ippsSinCos_64f_A26, ippsSinCos_64f_A50, ippsSinCos_64f_A53);
+  IPP_CHECK_STATUS(ippsSinCos(source.begin(), destSin.begin(), destCos.begin(),
+                              source.size()));
+}
+
+template <AccuracyLevels::SinglePrecision accuracy =
+              AccuracyLevels::SinglePrecision::A11>
+void ippCbrt(CIppVector32f const &source, CIppVector32f &dest) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(Ipp32f const *, Ipp32f *, int)> ippsCbrt{};
+  ippsCbrt = Private::ippAccuracySelect<accuracy>(
+      ippsCbrt_32f_A11, ippsCbrt_32f_A21, ippsCbrt_32f_A24);
+  IPP_CHECK_STATUS(ippsCbrt(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::DoublePrecision accuracy =
+              AccuracyLevels::DoublePrecision::A26>
+void ippCbrt(CIppVector64f const &source, CIppVector64f &dest) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(Ipp64f const *, Ipp64f *, int)> ippsCbrt{};
+  ippsCbrt = Private::ippAccuracySelect<accuracy>(
+      ippsCbrt_64f_A26, ippsCbrt_64f_A50, ippsCbrt_64f_A53);
+  IPP_CHECK_STATUS(ippsCbrt(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::SinglePrecision accuracy =
+              AccuracyLevels::SinglePrecision::A11>
+void ippInvSqrt(CIppVector32f const &source, CIppVector32f &dest) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(Ipp32f const *, Ipp32f *, int)> ippsInvSqrt{};
+  ippsInvSqrt = Private::ippAccuracySelect<accuracy>(
+      ippsInvSqrt_32f_A11, ippsInvSqrt_32f_A21, ippsInvSqrt_32f_A24);
+  IPP_CHECK_STATUS(ippsInvSqrt(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::DoublePrecision accuracy =
+              AccuracyLevels::DoublePrecision::A26>
+void ippInvSqrt(CIppVector64f const &source, CIppVector64f &dest) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(Ipp64f const *, Ipp64f *, int)> ippsInvSqrt{};
+  ippsInvSqrt = Private::ippAccuracySelect<accuracy>(
+      ippsInvSqrt_64f_A26, ippsInvSqrt_64f_A50, ippsInvSqrt_64f_A53);
+  IPP_CHECK_STATUS(ippsInvSqrt(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::SinglePrecision accuracy =
+              AccuracyLevels::SinglePrecision::A11>
+void ippErf(CIppVector32f const &source, CIppVector32f &dest) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(Ipp32f const *, Ipp32f *, int)> ippsErf{};
+  ippsErf = Private::ippAccuracySelect<accuracy>(
+      ippsErf_32f_A11, ippsErf_32f_A21, ippsErf_32f_A24);
+  IPP_CHECK_STATUS(ippsErf(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::DoublePrecision accuracy =
+              AccuracyLevels::DoublePrecision::A26>
+void ippErf(CIppVector64f const &source, CIppVector64f &dest) {
+  Private::ippVectorIsEqual(source, dest);
+  std::function<IppStatus(Ipp64f const *, Ipp64f *, int)> ippsErf{};
+  ippsErf = Private::ippAccuracySelect<accuracy>(
+      ippsErf_64f_A26, ippsErf_64f_A50, ippsErf_64f_A53);
+  IPP_CHECK_STATUS(ippsErf(source.begin(), dest.begin(), dest.size()));
+}
+
+template <AccuracyLevels::SinglePrecision accuracy =
+              AccuracyLevels::SinglePrecision::A11>
+void ippHypot(CIppVector32f const &sourceA, CIppVector32f const &sourceB,
+              CIppVector32f &dest) {
+  Private::ippVectorIsEqual(sourceA, dest);
+  Private::ippVectorIsEqual(sourceB, dest);
+  std::function<IppStatus(Ipp32f const *, Ipp32f const *, Ipp32f *, int)>
+      ippsHypot{};
+  ippsHypot = Private::ippAccuracySelect<accuracy>(
+      ippsHypot_32f_A11, ippsHypot_32f_A21, ippsHypot_32f_A24);
+  IPP_CHECK_STATUS(ippsHypot(sourceA.begin(), sourceB.begin(), dest.begin(),
+                             dest.size()));
+}
+
+template <AccuracyLevels::DoublePrecision accuracy =
+              AccuracyLevels::DoublePrecision::A26>
+void ippHypot(CIppVector64f const &sourceA, CIppVector64f const &sourceB,
+              CIppVector64f &dest) {
+  Private::ippVectorIsEqual(sourceA, dest);
+  Private::ippVectorIsEqual(sourceB, dest);
+  std::function<IppStatus(Ipp64f const *, Ipp64f const *, Ipp64f *, int)>
+      ippsHypot{};
+  ippsHypot = Private::ippAccuracySelect<accuracy>(
+      ippsHypot_64f_A26, ippsHypot_64f_A50, ippsHypot_64f_A53);
+  IPP_CHECK_STATUS(ippsHypot(sourceA.begin(), sourceB.begin(), dest.begin(),
+                             dest.size()));
+}
+
 inline void ippMagnitude(CIppVector32fc const &source, CIppVector32f &dest) {
   Private::ippVectorIsEqual(source, dest);
   IPP_CHECK_STATUS(
@@ -253,6 +661,114 @@ inline void ippPowerSpectr(CIppVector64f const &sourceRe,
                                        dest.begin(), dest.size()));
 }
 
+namespace Private {
+
+template <auto const accuracy, typename IppType>
+auto ippsLog10Function() {
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsLog10{};
+  if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsLog10 = ippAccuracySelect<accuracy>(
+        ippsLog10_32f_A11, ippsLog10_32f_A21, ippsLog10_32f_A24);
+  } else if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsLog10 = ippAccuracySelect<accuracy>(
+        ippsLog10_64f_A26, ippsLog10_64f_A50, ippsLog10_64f_A53);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  return ippsLog10;
+}
+
+// Power spectrum, log and scaling are done per chunk that stays in L1, so
+// the source is read and the destination written only once.
+template <auto const accuracy, typename IppType, typename PowerSpectr>
+void ippPowerSpectrDB(PowerSpectr powerSpectr, IppType *dest, int size,
+                      IppType reference, IppType epsilon) {
+  constexpr int chunkSize{2048};
+  std::function<IppStatus(IppType, IppType *, int)> ippsAddC{};
+  std::function<IppStatus(IppType *, int, IppType, IppType)> ippsNormalize{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsAddC = ippsAddC_64f_I;
+    ippsNormalize = ippsNormalize_64f_I;
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsAddC = ippsAddC_32f_I;
+    ippsNormalize = ippsNormalize_32f_I;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  auto const ippsLog10{ippsLog10Function<accuracy, IppType>()};
+  auto const offset{IppType(std::log10(reference))};
+  alignas(64) std::array<IppType, chunkSize> chunk;
+  for (int pos{}; pos < size; pos += chunkSize) {
+    auto const length{std::min(chunkSize, size - pos)};
+    IPP_CHECK_STATUS(powerSpectr(pos, chunk.data(), length));
+    IPP_CHECK_STATUS(ippsAddC(epsilon, chunk.data(), length));
+    IPP_CHECK_STATUS(ippsLog10(chunk.data(), dest + pos, length));
+    IPP_CHECK_STATUS(
+        ippsNormalize(dest + pos, length, offset, IppType(0.1)));
+  }
+}
+
+}  // namespace Private
+
+// dest = 10 * log10((|source|^2 + epsilon) / reference)
+template <AccuracyLevels::SinglePrecision const accuracy =
+              AccuracyLevels::SinglePrecision::A11>
+void ippPowerSpectrDB(
+    CIppVector32fc const &source, CIppVector32f &dest, Ipp32f reference = 1,
+    Ipp32f epsilon = std::numeric_limits<Ipp32f>::min()) {
+  Private::ippVectorIsEqual(source, dest);
+  Private::ippPowerSpectrDB<accuracy>(
+      [&source](int pos, Ipp32f *chunk, int length) {
+        return ippsPowerSpectr_32fc(source.begin() + pos, chunk, length);
+      },
+      dest.begin(), dest.size(), reference, epsilon);
+}
+
+template <AccuracyLevels::SinglePrecision const accuracy =
+              AccuracyLevels::SinglePrecision::A11>
+void ippPowerSpectrDB(
+    CIppVector32f const &sourceRe, CIppVector32f const &sourceIm,
+    CIppVector32f &dest, Ipp32f reference = 1,
+    Ipp32f epsilon = std::numeric_limits<Ipp32f>::min()) {
+  Private::ippVectorIsEqual(sourceRe, dest);
+  Private::ippVectorIsEqual(sourceIm, dest);
+  Private::ippPowerSpectrDB<accuracy>(
+      [&sourceRe, &sourceIm](int pos, Ipp32f *chunk, int length) {
+        return ippsPowerSpectr_32f(sourceRe.begin() + pos,
+                                   sourceIm.begin() + pos, chunk, length);
+      },
+      dest.begin(), dest.size(), reference, epsilon);
+}
+
+template <AccuracyLevels::DoublePrecision const accuracy =
+              AccuracyLevels::DoublePrecision::A26>
+void ippPowerSpectrDB(
+    CIppVector64fc const &source, CIppVector64f &dest, Ipp64f reference = 1,
+    Ipp64f epsilon = std::numeric_limits<Ipp64f>::min()) {
+  Private::ippVectorIsEqual(source, dest);
+  Private::ippPowerSpectrDB<accuracy>(
+      [&source](int pos, Ipp64f *chunk, int length) {
+        return ippsPowerSpectr_64fc(source.begin() + pos, chunk, length);
+      },
+      dest.begin(), dest.size(), reference, epsilon);
+}
+
+template <AccuracyLevels::DoublePrecision const accuracy =
+              AccuracyLevels::DoublePrecision::A26>
+void ippPowerSpectrDB(
+    CIppVector64f const &sourceRe, CIppVector64f const &sourceIm,
+    CIppVector64f &dest, Ipp64f reference = 1,
+    Ipp64f epsilon = std::numeric_limits<Ipp64f>::min()) {
+  Private::ippVectorIsEqual(sourceRe, dest);
+  Private::ippVectorIsEqual(sourceIm, dest);
+  Private::ippPowerSpectrDB<accuracy>(
+      [&sourceRe, &sourceIm](int pos, Ipp64f *chunk, int length) {
+        return ippsPowerSpectr_64f(sourceRe.begin() + pos,
+                                   sourceIm.begin() + pos, chunk, length);
+      },
+      dest.begin(), dest.size(), reference, epsilon);
+}
+
 template <typename IppType>
 void ippConj(CIppVector<IppType> const &source, CIppVector<IppType> &dest) {
   Private::ippVectorIsEqual(source, dest);
@@ -267,6 +783,375 @@ void ippConj(CIppVector<IppType> const &source, CIppVector<IppType> &dest) {
   IPP_CHECK_STATUS(ippsConj(source.begin(), dest.begin(), dest.size()));
 }
 
+template <typename IppType>
+void ippCartToPolar(CIppVector<IppType> const &source,
+                    CIppVector<Private::IppBaseTypeT<IppType>> &magnitude,
+                    CIppVector<Private::IppBaseTypeT<IppType>> &phase) {
+  using BaseType = Private::IppBaseTypeT<IppType>;
+  Private::ippVectorIsEqual(source, magnitude);
+  Private::ippVectorIsEqual(source, phase);
+  std::function<IppStatus(IppType const *, BaseType *, BaseType *, int)>
+      ippsCartToPolar{};
+  if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsCartToPolar = ippsCartToPolar_64fc;
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsCartToPolar = ippsCartToPolar_32fc;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsCartToPolar(source.begin(), magnitude.begin(),
+                                   phase.begin(), source.size()));
+}
+
+template <typename IppType>
+void ippCartToPolar(CIppVector<IppType> const &sourceRe,
+                    CIppVector<IppType> const &sourceIm,
+                    CIppVector<IppType> &magnitude,
+                    CIppVector<IppType> &phase) {
+  Private::ippVectorIsEqual(sourceRe, magnitude);
+  Private::ippVectorIsEqual(sourceIm, magnitude);
+  Private::ippVectorIsEqual(sourceRe, phase);
+  std::function<IppStatus(IppType const *, IppType const *, IppType *,
+                          IppType *, int)>
+      ippsCartToPolar{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsCartToPolar = ippsCartToPolar_64f;
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsCartToPolar = ippsCartToPolar_32f;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsCartToPolar(sourceRe.begin(), sourceIm.begin(),
+                                   magnitude.begin(), phase.begin(),
+                                   sourceRe.size()));
+}
+
+template <typename IppType>
+void ippPolarToCart(CIppVector<Private::IppBaseTypeT<IppType>> const &magnitude,
+                    CIppVector<Private::IppBaseTypeT<IppType>> const &phase,
+                    CIppVector<IppType> &dest) {
+  using BaseType = Private::IppBaseTypeT<IppType>;
+  Private::ippVectorIsEqual(magnitude, dest);
+  Private::ippVectorIsEqual(phase, dest);
+  std::function<IppStatus(BaseType const *, BaseType const *, IppType *, int)>
+      ippsPolarToCart{};
+  if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsPolarToCart = ippsPolarToCart_64fc;
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsPolarToCart = ippsPolarToCart_32fc;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsPolarToCart(magnitude.begin(), phase.begin(),
+                                   dest.begin(), dest.size()));
+}
+
+template <typename IppType>
+void ippPolarToCart(CIppVector<IppType> const &magnitude,
+                    CIppVector<IppType> const &phase,
+                    CIppVector<IppType> &destRe, CIppVector<IppType> &destIm) {
+  Private::ippVectorIsEqual(magnitude, destRe);
+  Private::ippVectorIsEqual(phase, destRe);
+  Private::ippVectorIsEqual(magnitude, destIm);
+  std::function<IppStatus(IppType const *, IppType const *, IppType *,
+                          IppType *, int)>
+      ippsPolarToCart{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsPolarToCart = ippsPolarToCart_64f;
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsPolarToCart = ippsPolarToCart_32f;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsPolarToCart(magnitude.begin(), phase.begin(),
+                                   destRe.begin(), destIm.begin(),
+                                   destRe.size()));
+}
+
+// dest = sourceA * conj(sourceB)
+template <typename IppType>
+void ippMulByConj(CIppVector<IppType> const &sourceA,
+                  CIppVector<IppType> const &sourceB,
+                  CIppVector<IppType> &dest) {
+  Private::ippVectorIsEqual(sourceA, dest);
+  Private::ippVectorIsEqual(sourceB, dest);
+  std::function<IppStatus(IppType const *, IppType const *, IppType *, int)>
+      ippsMulByConj{};
+  if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsMulByConj = ippsMulByConj_64fc_A53;
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsMulByConj = ippsMulByConj_32fc_A24;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsMulByConj(sourceA.begin(), sourceB.begin(),
+                                 dest.begin(), dest.size()));
+}
+
+// vector = vector * conj(source)
+template <typename IppType>
+void ippMulByConj(CIppVector<IppType> const &source,
+                  CIppVector<IppType> &vector) {
+  Private::ippVectorIsEqual(source, vector);
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsConj{};
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsMul{};
+  if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsConj = ippsConj_64fc;
+    ippsMul = ippsMul_64fc_I;
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsConj = ippsConj_32fc;
+    ippsMul = ippsMul_32fc_I;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  constexpr int chunkSize{1024};
+  std::array<IppType, chunkSize> chunk;
+  for (int pos{}; pos < vector.size(); pos += chunkSize) {
+    auto const length{std::min(chunkSize, vector.size() - pos)};
+    IPP_CHECK_STATUS(ippsConj(source.begin() + pos, chunk.data(), length));
+    IPP_CHECK_STATUS(ippsMul(chunk.data(), vector.begin() + pos, length));
+  }
+}
+
+// Split layout; dest may alias the sources.
+template <typename IppType>
+void ippMulByConj(CIppVector<IppType> const &sourceARe,
+                  CIppVector<IppType> const &sourceAIm,
+                  CIppVector<IppType> const &sourceBRe,
+                  CIppVector<IppType> const &sourceBIm,
+                  CIppVector<IppType> &destRe, CIppVector<IppType> &destIm) {
+  Private::ippVectorIsEqual(sourceARe, destRe);
+  Private::ippVectorIsEqual(sourceAIm, destRe);
+  Private::ippVectorIsEqual(sourceBRe, destRe);
+  Private::ippVectorIsEqual(sourceBIm, destRe);
+  Private::ippVectorIsEqual(destIm, destRe);
+  std::function<IppStatus(IppType const *, IppType const *, IppType *, int)>
+      ippsMul{}, ippsAddProduct{};
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsSub{},
+      ippsCopy{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsMul = ippsMul_64f;
+    ippsAddProduct = ippsAddProduct_64f;
+    ippsSub = ippsSub_64f_I;
+    ippsCopy = ippsCopy_64f;
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsMul = ippsMul_32f;
+    ippsAddProduct = ippsAddProduct_32f;
+    ippsSub = ippsSub_32f_I;
+    ippsCopy = ippsCopy_32f;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  constexpr int chunkSize{1024};
+  std::array<IppType, chunkSize> re, im, tmp;
+  for (int pos{}; pos < destRe.size(); pos += chunkSize) {
+    auto const length{std::min(chunkSize, destRe.size() - pos)};
+    auto const *aRe{sourceARe.begin() + pos};
+    auto const *aIm{sourceAIm.begin() + pos};
+    auto const *bRe{sourceBRe.begin() + pos};
+    auto const *bIm{sourceBIm.begin() + pos};
+    IPP_CHECK_STATUS(ippsMul(aRe, bRe, re.data(), length));
+    IPP_CHECK_STATUS(ippsAddProduct(aIm, bIm, re.data(), length));
+    IPP_CHECK_STATUS(ippsMul(aIm, bRe, im.data(), length));
+    IPP_CHECK_STATUS(ippsMul(aRe, bIm, tmp.data(), length));
+    IPP_CHECK_STATUS(ippsSub(tmp.data(), im.data(), length));
+    IPP_CHECK_STATUS(ippsCopy(re.data(), destRe.begin() + pos, length));
+    IPP_CHECK_STATUS(ippsCopy(im.data(), destIm.begin() + pos, length));
+  }
+}
+
+// dest = source * real
+template <typename IppType>
+void ippMulReal(CIppVector<IppType> const &source,
+                CIppVector<Private::IppBaseTypeT<IppType>> const &real,
+                CIppVector<IppType> &dest) {
+  Private::ippVectorIsEqual(source, dest);
+  Private::ippVectorIsEqual(real, dest);
+  if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    IPP_CHECK_STATUS(ippsMul_32f32fc(real.begin(), source.begin(),
+                                     dest.begin(), dest.size()));
+  } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    // No 64f64fc multiply in IPP: widen the real factor per chunk.
+    constexpr int chunkSize{1024};
+    std::array<Ipp64fc, chunkSize> chunk;
+    for (int pos{}; pos < dest.size(); pos += chunkSize) {
+      auto const length{std::min(chunkSize, dest.size() - pos)};
+      IPP_CHECK_STATUS(ippsRealToCplx_64f(real.begin() + pos, nullptr,
+                                          chunk.data(), length));
+      IPP_CHECK_STATUS(ippsMul_64fc(chunk.data(), source.begin() + pos,
+                                    dest.begin() + pos, length));
+    }
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+}
+
+// vector = vector * real
+template <typename IppType>
+void ippMulReal(CIppVector<Private::IppBaseTypeT<IppType>> const &real,
+                CIppVector<IppType> &vector) {
+  Private::ippVectorIsEqual(real, vector);
+  if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    IPP_CHECK_STATUS(
+        ippsMul_32f32fc_I(real.begin(), vector.begin(), vector.size()));
+  } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippMulReal(vector, real, vector);
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+}
+
+// Split layout: destRe = sourceRe * real, destIm = sourceIm * real.
+template <typename IppType>
+void ippMulReal(CIppVector<IppType> const &sourceRe,
+                CIppVector<IppType> const &sourceIm,
+                CIppVector<IppType> const &real, CIppVector<IppType> &destRe,
+                CIppVector<IppType> &destIm) {
+  Private::ippVectorIsEqual(sourceRe, destRe);
+  Private::ippVectorIsEqual(sourceIm, destIm);
+  Private::ippVectorIsEqual(real, destRe);
+  Private::ippVectorIsEqual(real, destIm);
+  std::function<IppStatus(IppType const *, IppType const *, IppType *, int)>
+      ippsMul{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsMul = ippsMul_64f;
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsMul = ippsMul_32f;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(
+      ippsMul(sourceRe.begin(), real.begin(), destRe.begin(), destRe.size()));
+  IPP_CHECK_STATUS(
+      ippsMul(sourceIm.begin(), real.begin(), destIm.begin(), destIm.size()));
+}
+
+// vector += sourceA * sourceB
+template <typename IppType>
+void ippAddProduct(CIppVector<IppType> const &sourceA,
+                   CIppVector<IppType> const &sourceB,
+                   CIppVector<IppType> &vector) {
+  Private::ippVectorIsEqual(sourceA, vector);
+  Private::ippVectorIsEqual(sourceB, vector);
+  std::function<IppStatus(IppType const *, IppType const *, IppType *, int)>
+      ippsAddProduct{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsAddProduct = ippsAddProduct_64f;
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsAddProduct = ippsAddProduct_32f;
+  } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsAddProduct = ippsAddProduct_64fc;
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsAddProduct = ippsAddProduct_32fc;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsAddProduct(sourceA.begin(), sourceB.begin(),
+                                  vector.begin(), vector.size()));
+}
+
+namespace Private {
+
+inline constexpr int k_FusedChunkSize{1024};
+
+// dest = source * value + addend, one L1-sized chunk at a time.
+template <typename IppType>
+void ippMulCAdd(IppType const *source, IppType value, IppType const *addend,
+                IppType *dest, int size) {
+  std::function<IppStatus(IppType const *, IppType, IppType *, int)>
+      ippsMulC{};
+  std::function<IppStatus(IppType const *, IppType const *, IppType *, int)>
+      ippsAdd{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsMulC = ippsMulC_64f;
+    ippsAdd = ippsAdd_64f;
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsMulC = ippsMulC_32f;
+    ippsAdd = ippsAdd_32f;
+  } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsMulC = ippsMulC_64fc;
+    ippsAdd = ippsAdd_64fc;
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsMulC = ippsMulC_32fc;
+    ippsAdd = ippsAdd_32fc;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  std::array<IppType, k_FusedChunkSize> chunk;
+  for (int pos{}; pos < size; pos += k_FusedChunkSize) {
+    auto const length{std::min(k_FusedChunkSize, size - pos)};
+    IPP_CHECK_STATUS(ippsMulC(source + pos, value, chunk.data(), length));
+    IPP_CHECK_STATUS(ippsAdd(chunk.data(), addend + pos, dest + pos, length));
+  }
+}
+
+}  // namespace Private
+
+// vector += source * value
+template <typename IppType>
+void ippAddProductC(CIppVector<IppType> const &source, IppType value,
+                    CIppVector<IppType> &vector) {
+  Private::ippVectorIsEqual(source, vector);
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    IPP_CHECK_STATUS(ippsAddProductC_64f(source.begin(), value, vector.begin(),
+                                         vector.size()));
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    IPP_CHECK_STATUS(ippsAddProductC_32f(source.begin(), value, vector.begin(),
+                                         vector.size()));
+  } else if constexpr (std::is_same_v<IppType, Ipp64fc> ||
+                       std::is_same_v<IppType, Ipp32fc>) {
+    // IPP has no complex AddProductC.
+    Private::ippMulCAdd(source.begin(), value, vector.begin(), vector.begin(),
+                        vector.size());
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+}
+
+// vector += source * value, real value on complex data
+template <typename IppType>
+void ippAddProductC(CIppVector<IppType> const &source,
+                    Private::IppBaseTypeT<IppType> value,
+                    CIppVector<IppType> &vector,
+                    std::enable_if_t<Private::ippComponents<IppType> == 2,
+                                     int> = 0) {
+  Private::ippVectorIsEqual(source, vector);
+  Private::ippAddScaled(source.begin(), value, vector.begin(), vector.size());
+}
+
+// dest = source * value + addend
+template <typename IppType>
+void ippMulCAdd(CIppVector<IppType> const &source, IppType value,
+                CIppVector<IppType> const &addend, CIppVector<IppType> &dest) {
+  Private::ippVectorIsEqual(source, dest);
+  Private::ippVectorIsEqual(addend, dest);
+  Private::ippMulCAdd(source.begin(), value, addend.begin(), dest.begin(),
+                      dest.size());
+}
+
+template <typename IppType>
+IppType ippDotProd(CIppVector<IppType> const &sourceA,
+                   CIppVector<IppType> const &sourceB) {
+  Private::ippVectorIsEqual(sourceA, sourceB);
+  std::function<IppStatus(IppType const *, IppType const *, int, IppType *)>
+      ippsDotProd{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsDotProd = ippsDotProd_64f;
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsDotProd = ippsDotProd_32f;
+  } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsDotProd = ippsDotProd_64fc;
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsDotProd = ippsDotProd_32fc;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IppType result{};
+  IPP_CHECK_STATUS(ippsDotProd(sourceA.begin(), sourceB.begin(),
+                               sourceA.size(), &result));
+  return result;
+}
+
 template <typename IppType>
 void ippMaxEvery(CIppVector<IppType> const &sourceA,
                  CIppVector<IppType> const &sourceB,
@@ -277,6 +1162,8 @@ void ippMaxEvery(CIppVector<IppType> const &sourceA,
       ippsMaxEvery{};
   if constexpr (std::is_same_v<IppType, Ipp64f>) {
     ippsMaxEvery = ippsMaxEvery_64f;
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsMaxEvery = ippsMaxEvery_32f;
   } else {
     static_assert(std::is_void_v<IppType>, "unsupported type");
   }
@@ -284,6 +1171,21 @@ void ippMaxEvery(CIppVector<IppType> const &sourceA,
                                 dest.size()));
 }
 
+template <typename IppType>
+void ippMaxEvery(CIppVector<IppType> const &source,
+                 CIppVector<IppType> &vector) {
+  Private::ippVectorIsEqual(source, vector);
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsMaxEvery{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsMaxEvery = ippsMaxEvery_64f_I;
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsMaxEvery = ippsMaxEvery_32f_I;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsMaxEvery(source.begin(), vector.begin(), vector.size()));
+}
+
 template <typename IppType>
 void ippMinEvery(CIppVector<IppType> const &sourceA,
                  CIppVector<IppType> const &sourceB,
@@ -294,6 +1196,8 @@ void ippMinEvery(CIppVector<IppType> const &sourceA,
       ippsMinEvery{};
   if constexpr (std::is_same_v<IppType, Ipp64f>) {
     ippsMinEvery = ippsMinEvery_64f;
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsMinEvery = ippsMinEvery_32f;
   } else {
     static_assert(std::is_void_v<IppType>, "unsupported type");
   }
@@ -301,6 +1205,21 @@ void ippMinEvery(CIppVector<IppType> const &sourceA,
                                 dest.size()));
 }
 
+template <typename IppType>
+void ippMinEvery(CIppVector<IppType> const &source,
+                 CIppVector<IppType> &vector) {
+  Private::ippVectorIsEqual(source, vector);
+  std::function<IppStatus(IppType const *, IppType *, int)> ippsMinEvery{};
+  if constexpr (std::is_same_v<IppType, Ipp64f>) {
+    ippsMinEvery = ippsMinEvery_64f_I;
+  } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+    ippsMinEvery = ippsMinEvery_32f_I;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsMinEvery(source.begin(), vector.begin(), vector.size()));
+}
+
 }  // namespace IntelIppTL
 
 #endif  // IIPPTL_MATH_HPP
@@ -0,0 +1,211 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_PHASE_HPP
+#define IIPPTL_PHASE_HPP
+
+#include <algorithm>
+#include <array>
+
+#include "iipptl_vector.hpp"
+
+namespace IntelIppTL {
+
+namespace Private {
+
+inline constexpr int k_PhaseChunkSize{1024};
+inline constexpr double k_TwoPi{6.283185307179586476925286766559};
+
+template <typename IppType>
+void ippPhase(IppType const *source, IppBaseTypeT<IppType> *dest, int size) {
+  std::function<IppStatus(IppType const *, IppBaseTypeT<IppType> *, int)>
+      ippsPhase{};
+  if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+    ippsPhase = ippsPhase_64fc;
+  } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+    ippsPhase = ippsPhase_32fc;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsPhase(source, dest, size));
+}
+
+}  // namespace Private
+
+template <typename IppType>
+class CIppPhaseUnwrap {
+ public:
+  using ValueType = IppType;
+  using IppVector = CIppVector<IppType>;
+  using SizeType = typename IppVector::SizeType;
+  CIppPhaseUnwrap() = default;
+  CIppPhaseUnwrap(CIppPhaseUnwrap const &) = default;
+  CIppPhaseUnwrap(CIppPhaseUnwrap &&) noexcept = default;
+  CIppPhaseUnwrap &operator=(CIppPhaseUnwrap const &) = default;
+  CIppPhaseUnwrap &operator=(CIppPhaseUnwrap &&) noexcept = default;
+  virtual ~CIppPhaseUnwrap() noexcept = default;
+  void reset() noexcept {
+    m_LastPhase = 0;
+    m_Unwrapped = 0;
+    m_NotFirst = false;
+  }
+  void process(IppVector const &phase, IppVector &dest) {
+    Private::ippVectorIsEqual(phase, dest);
+    if (dest.empty()) {
+      return;
+    }
+    unwrap(phase.begin(), dest.begin(), dest.size());
+  }
+  template <typename Type,
+            typename = std::enable_if_t<
+                std::is_same_v<Private::IppBaseTypeT<Type>, IppType> &&
+                !std::is_same_v<Type, IppType>>>
+  void process(CIppVector<Type> const &source, IppVector &dest) {
+    Private::ippVectorIsEqual(source, dest);
+    std::array<IppType, Private::k_PhaseChunkSize> phase;
+    for (SizeType pos{}; pos < dest.size(); pos += Private::k_PhaseChunkSize) {
+      auto const size{std::min(Private::k_PhaseChunkSize, dest.size() - pos)};
+      Private::ippPhase(source.begin() + pos, phase.data(), size);
+      unwrap(phase.data(), dest.begin() + pos, size);
+    }
+  }
+  inline double phase() const noexcept { return m_Unwrapped; }
+
+ private:
+  // Wrapped differences are computed with IPP on an L1-sized chunk; only the
+  // running sum over them is serial.
+  void unwrap(IppType const *phase, IppType *dest, SizeType size) {
+    std::function<IppStatus(IppType const *, IppType const *, IppType *, int)>
+        ippsSub{};
+    std::function<IppStatus(IppType const *, IppType, IppType *, int)>
+        ippsMulC{}, ippsAddProductC{};
+    std::function<IppStatus(IppType const *, IppType *, int)> ippsNearbyInt{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      ippsSub = ippsSub_64f;
+      ippsMulC = ippsMulC_64f;
+      ippsAddProductC = ippsAddProductC_64f;
+      ippsNearbyInt = ippsNearbyInt_64f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      ippsSub = ippsSub_32f;
+      ippsMulC = ippsMulC_32f;
+      ippsAddProductC = ippsAddProductC_32f;
+      ippsNearbyInt = ippsNearbyInt_32f;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    if (!m_NotFirst) {
+      m_LastPhase = phase[0];
+      m_Unwrapped = phase[0];
+      m_NotFirst = true;
+    }
+    std::array<IppType, Private::k_PhaseChunkSize> diff, turns;
+    for (SizeType pos{}; pos < size; pos += Private::k_PhaseChunkSize) {
+      auto const length{std::min(Private::k_PhaseChunkSize, size - pos)};
+      diff[0] = phase[pos] - m_LastPhase;
+      if (length > 1) {
+        IPP_CHECK_STATUS(ippsSub(phase + pos, phase + pos + 1, diff.data() + 1,
+                                 length - 1));
+      }
+      IPP_CHECK_STATUS(ippsMulC(diff.data(), IppType(1 / Private::k_TwoPi),
+                                turns.data(), length));
+      IPP_CHECK_STATUS(ippsNearbyInt(turns.data(), turns.data(), length));
+      IPP_CHECK_STATUS(ippsAddProductC(turns.data(),
+                                       IppType(-Private::k_TwoPi),
+                                       diff.data(), length));
+      for (SizeType i{}; i < length; ++i) {
+        m_Unwrapped += diff[i];
+        dest[pos + i] = IppType(m_Unwrapped);
+      }
+      m_LastPhase = phase[pos + length - 1];
+    }
+  }
+  IppType m_LastPhase{};
+  double m_Unwrapped{};
+  bool m_NotFirst{false};
+};
+
+using CIppPhaseUnwrap64f = CIppPhaseUnwrap<Ipp64f>;
+using CIppPhaseUnwrap32f = CIppPhaseUnwrap<Ipp32f>;
+
+// Instantaneous frequency in radians per sample, arg(x[n] * conj(x[n - 1])),
+// optionally scaled (e.g. by fs / 2pi for Hz).
+template <typename IppType>
+class CIppInstFrequency {
+ public:
+  using ValueType = IppType;
+  using BaseType = Private::IppBaseTypeT<IppType>;
+  using IppVector = CIppVector<IppType>;
+  using IppBaseVector = CIppVector<BaseType>;
+  using SizeType = typename IppVector::SizeType;
+  CIppInstFrequency(BaseType gain = 1) : m_Gain{gain} {}
+  CIppInstFrequency(CIppInstFrequency const &) = default;
+  CIppInstFrequency(CIppInstFrequency &&) noexcept = default;
+  CIppInstFrequency &operator=(CIppInstFrequency const &) = default;
+  CIppInstFrequency &operator=(CIppInstFrequency &&) noexcept = default;
+  virtual ~CIppInstFrequency() noexcept = default;
+  void reset() noexcept { m_LastSample = IppType{}; }
+  inline BaseType gain() const noexcept { return m_Gain; }
+  inline void gain(BaseType value) noexcept { m_Gain = value; }
+  void process(IppVector const &source, IppBaseVector &dest) {
+    Private::ippVectorIsEqual(source, dest);
+    std::function<IppStatus(IppType const *, IppType const *, IppType *, int)>
+        ippsMulByConj{};
+    std::function<IppStatus(BaseType, BaseType *, int)> ippsMulC{};
+    if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+      ippsMulByConj = ippsMulByConj_64fc_A53;
+      ippsMulC = ippsMulC_64f_I;
+    } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+      ippsMulByConj = ippsMulByConj_32fc_A24;
+      ippsMulC = ippsMulC_32f_I;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    auto const size{dest.size()};
+    if (size == 0) {
+      return;
+    }
+    std::array<IppType, Private::k_PhaseChunkSize> product;
+    for (SizeType pos{}; pos < size; pos += Private::k_PhaseChunkSize) {
+      auto const length{std::min(Private::k_PhaseChunkSize, size - pos)};
+      auto const *current{source.begin() + pos};
+      auto const &previous{(pos == 0) ? m_LastSample : current[-1]};
+      product[0] = {current[0].re * previous.re + current[0].im * previous.im,
+                    current[0].im * previous.re - current[0].re * previous.im};
+      if (length > 1) {
+        IPP_CHECK_STATUS(ippsMulByConj(current + 1, current,
+                                       product.data() + 1, length - 1));
+      }
+      Private::ippPhase(product.data(), dest.begin() + pos, length);
+      if (m_Gain != 1) {
+        IPP_CHECK_STATUS(ippsMulC(m_Gain, dest.begin() + pos, length));
+      }
+    }
+    m_LastSample = source[size - 1];
+  }
+
+ private:
+  BaseType m_Gain{1};
+  IppType m_LastSample{};
+};
+
+using CIppInstFrequency64fc = CIppInstFrequency<Ipp64fc>;
+using CIppInstFrequency32fc = CIppInstFrequency<Ipp32fc>;
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_PHASE_HPP
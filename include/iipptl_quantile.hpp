@@ -0,0 +1,150 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_QUANTILE_HPP
+#define IIPPTL_QUANTILE_HPP
+
+#include <algorithm>
+
+#include "iipptl_vector.hpp"
+
+namespace IntelIppTL {
+
+// Per-bin streaming quantile estimate by stochastic approximation:
+//   q += gain * s * (p - [x < q]),  s = running mean of |x - q|.
+// Bins are processed in cache-sized chunks, so memory is fixed to the
+// estimate, the scale and two chunk-sized scratch vectors.
+template <typename IppType>
+class CIppQuantile {
+ public:
+  using ValueType = IppType;
+  using IppVector = CIppVector<IppType>;
+  using SizeType = typename IppVector::SizeType;
+  CIppQuantile() = default;
+  CIppQuantile(SizeType vectorSize, double quantile = 0.5, double gain = 0.02,
+               double scaleAlpha = 0.01)
+      : m_Quantile{quantile},
+        m_Gain{gain},
+        m_ScaleAlpha{scaleAlpha},
+        m_QuantileVector{vectorSize},
+        m_ScaleVector{vectorSize},
+        m_DiffVector{std::min(vectorSize, k_ChunkSize)},
+        m_AbsVector{std::min(vectorSize, k_ChunkSize)} {
+    if (vectorSize <= 0 || quantile <= 0 || quantile >= 1 || gain <= 0 ||
+        scaleAlpha <= 0 || scaleAlpha > 1) {
+      throw std::invalid_argument("CIppQuantile: invalid ctor argument");
+    }
+    reset();
+  }
+  CIppQuantile(CIppQuantile const &) = default;
+  CIppQuantile(CIppQuantile &&) noexcept = default;
+  CIppQuantile &operator=(CIppQuantile const &) = default;
+  CIppQuantile &operator=(CIppQuantile &&) noexcept = default;
+  virtual ~CIppQuantile() noexcept = default;
+  CIppQuantile &operator+=(IppVector const &rhs) {
+    add(rhs);
+    return *this;
+  }
+  void add(IppVector const &vector) {
+    Private::ippVectorIsEqual(vector, m_QuantileVector);
+    if (m_Count == 0) {
+      m_QuantileVector = vector;
+      ++m_Count;
+      return;
+    }
+    std::function<IppStatus(IppType const *, IppType const *, IppType *, int)>
+        ippsSub{};
+    std::function<IppStatus(IppType const *, IppType *, int)> ippsAbs{};
+    std::function<IppStatus(IppType, IppType *, int)> ippsMulC{};
+    std::function<IppStatus(IppType const *, IppType, IppType *, int)>
+        ippsAddProductC{};
+    std::function<IppStatus(IppType *, int, IppType, IppType, IppType,
+                            IppType)>
+        ippsThreshold_LTValGTVal{};
+    std::function<IppStatus(IppType const *, IppType const *, IppType *, int)>
+        ippsAddProduct{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      ippsSub = ippsSub_64f;
+      ippsAbs = ippsAbs_64f;
+      ippsMulC = ippsMulC_64f_I;
+      ippsAddProductC = ippsAddProductC_64f;
+      ippsThreshold_LTValGTVal = ippsThreshold_LTValGTVal_64f_I;
+      ippsAddProduct = ippsAddProduct_64f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      ippsSub = ippsSub_32f;
+      ippsAbs = ippsAbs_32f;
+      ippsMulC = ippsMulC_32f_I;
+      ippsAddProductC = ippsAddProductC_32f;
+      ippsThreshold_LTValGTVal = ippsThreshold_LTValGTVal_32f_I;
+      ippsAddProduct = ippsAddProduct_32f;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    // Plain running mean of |x - q| until it reaches the requested alpha.
+    auto const alpha{std::max(m_ScaleAlpha, 1. / m_Count)};
+    auto const below{IppType(m_Gain * (m_Quantile - 1))};
+    auto const above{IppType(m_Gain * m_Quantile)};
+    auto *diff{m_DiffVector.begin()};
+    auto *abs{m_AbsVector.begin()};
+    for (SizeType pos{}; pos < m_QuantileVector.size(); pos += k_ChunkSize) {
+      auto const size{std::min(k_ChunkSize, m_QuantileVector.size() - pos)};
+      auto *quantile{m_QuantileVector.begin() + pos};
+      auto *scale{m_ScaleVector.begin() + pos};
+      IPP_CHECK_STATUS(ippsSub(quantile, vector.begin() + pos, diff, size));
+      IPP_CHECK_STATUS(ippsAbs(diff, abs, size));
+      IPP_CHECK_STATUS(ippsMulC(IppType(1 - alpha), scale, size));
+      IPP_CHECK_STATUS(ippsAddProductC(abs, IppType(alpha), scale, size));
+      IPP_CHECK_STATUS(
+          ippsThreshold_LTValGTVal(diff, size, 0, below, 0, above));
+      IPP_CHECK_STATUS(ippsAddProduct(scale, diff, quantile, size));
+    }
+    ++m_Count;
+  }
+  inline void get(IppVector &vector) const { vector = m_QuantileVector; }
+  inline IppVector const &data() const noexcept { return m_QuantileVector; }
+  inline IppVector const &scale() const noexcept { return m_ScaleVector; }
+  inline double quantile() const noexcept { return m_Quantile; }
+  void reset() {
+    m_QuantileVector.clear();
+    m_ScaleVector.clear();
+    m_Count = 0;
+  }
+  void reinit(SizeType vectorSize, double quantile = 0.5, double gain = 0.02,
+              double scaleAlpha = 0.01) {
+    auto tmp{CIppQuantile(vectorSize, quantile, gain, scaleAlpha)};
+    std::swap(*this, tmp);
+  }
+
+ private:
+  static constexpr SizeType k_ChunkSize{4096};
+  double m_Quantile{0.5};
+  double m_Gain{};
+  double m_ScaleAlpha{};
+  long long m_Count{};
+  IppVector m_QuantileVector{};
+  IppVector m_ScaleVector{};
+  IppVector m_DiffVector{};
+  IppVector m_AbsVector{};
+};
+
+using CIppQuantile64f = CIppQuantile<Ipp64f>;
+using CIppQuantile32f = CIppQuantile<Ipp32f>;
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_QUANTILE_HPP
@@ -19,20 +19,25 @@
 #ifndef IIPPTL_QUEUE_HPP
 #define IIPPTL_QUEUE_HPP
 
+#include "iipptl_convert.hpp"
 #include "iipptl_vector.hpp"
 
 namespace IntelIppTL {
 
-template <typename IppType>
+// StorageType lets the ring hold a narrower type (IppFloat16, IppBFloat16)
+// than the vectors pushed and popped; front() and back() expose the stored
+// vectors.
+template <typename IppType, typename StorageType = IppType>
 class CIppQueue {
  public:
   using ValueType = IppType;
   using IppVector = CIppVector<IppType>;
+  using StorageVector = CIppVector<StorageType>;
   using SizeType = typename IppVector::SizeType;
   CIppQueue() = default;
   CIppQueue(SizeType vectorSize, SizeType queueSize = 1)
       : m_QueueVectorSize{vectorSize},
-        m_RingBuffer(queueSize, IppVector(vectorSize)) {
+        m_RingBuffer(queueSize, StorageVector(vectorSize)) {
     if (vectorSize <= 0 || queueSize <= 0) {
       throw std::invalid_argument("CIppQueue: invalid ctor argument");
     }
@@ -45,29 +50,30 @@ class CIppQueue {
   virtual ~CIppQueue() noexcept = default;
   void reset() noexcept {
     for (auto &vector : m_RingBuffer) {
-      vector = 0;
+      vector.clear();
     }
     m_QueueCount = 0;
   }
-  inline IppVector const &front() const noexcept {
+  inline StorageVector const &front() const noexcept {
+    return m_RingBuffer[m_QueueCount];
+  }
+  inline StorageVector &front() noexcept {
     return m_RingBuffer[m_QueueCount];
   }
-  inline IppVector &front() noexcept { return m_RingBuffer[m_QueueCount]; }
   void push() noexcept {
-    if (++m_QueueHead == m_RingBuffer.size()) {
+    if (++m_QueueHead == SizeType(m_RingBuffer.size())) {
       m_QueueHead = 0;
     }
-    if (m_QueueCount < m_RingBuffer.size()) {
+    if (m_QueueCount < SizeType(m_RingBuffer.size())) {
       ++m_QueueCount;
     }
   }
   void push(IppVector const &vector) noexcept {
-    auto &ref{front()};
-    ref = vector;
+    Private::ippConvertStorage(vector, front());
     push();
   }
   void pop() noexcept {
-    if (++m_QueueTail == m_RingBuffer.size()) {
+    if (++m_QueueTail == SizeType(m_RingBuffer.size())) {
       m_QueueTail = 0;
     }
     if (m_QueueCount > 0) {
@@ -75,16 +81,16 @@ class CIppQueue {
     }
   }
   void pop(IppVector &vector) noexcept {
-    vector = back();
+    Private::ippConvertStorage(back(), vector);
     pop();
   }
-  inline IppVector &back() noexcept { return m_RingBuffer[m_QueueTail]; }
-  inline IppVector const &back() const noexcept {
+  inline StorageVector &back() noexcept { return m_RingBuffer[m_QueueTail]; }
+  inline StorageVector const &back() const noexcept {
     return m_RingBuffer[m_QueueTail];
   }
   inline bool empty() const noexcept { return (m_QueueCount == 0); }
   inline bool full() const noexcept {
-    return (m_QueueCount == m_RingBuffer.size());
+    return (m_QueueCount == SizeType(m_RingBuffer.size()));
   }
   inline SizeType size() const noexcept { return m_QueueCount; }
   inline SizeType max_size() const noexcept { return int(m_RingBuffer.size()); }
@@ -92,7 +98,8 @@ class CIppQueue {
     if (vectorSize <= 0 || queueSize <= 0) {
       throw std::invalid_argument("CIppQueue: invalid reinit argument");
     }
-    if (m_RingBuffer.size() != queueSize || m_QueueVectorSize != vectorSize) {
+    if (SizeType(m_RingBuffer.size()) != queueSize ||
+        m_QueueVectorSize != vectorSize) {
       auto tmp{CIppQueue(vectorSize, queueSize)};
       std::swap(*this, tmp);
       reset();
@@ -103,8 +110,8 @@ class CIppQueue {
     if (queueSize <= 0) {
       throw std::invalid_argument("CIppQueue: invalid resize argument");
     }
-    if (m_RingBuffer.size() != queueSize) {
-      m_RingBuffer.resize(queueSize, IppVector(m_QueueVectorSize));
+    if (SizeType(m_RingBuffer.size()) != queueSize) {
+      m_RingBuffer.resize(queueSize, StorageVector(m_QueueVectorSize));
       reset();
     }
   }
@@ -114,13 +121,15 @@ class CIppQueue {
   SizeType m_QueueTail{};
   SizeType m_QueueCount{};
   SizeType m_QueueVectorSize{};
-  std::vector<IppVector> m_RingBuffer{};
+  std::vector<StorageVector> m_RingBuffer{};
 };
 
 using CIppQueue64f = CIppQueue<Ipp64f>;
 using CIppQueue64fc = CIppQueue<Ipp64fc>;
 using CIppQueue32f = CIppQueue<Ipp32f>;
 using CIppQueue32fc = CIppQueue<Ipp32fc>;
+using CIppQueue16f = CIppQueue<Ipp32f, IppFloat16>;
+using CIppQueue16bf = CIppQueue<Ipp32f, IppBFloat16>;
 
 }  // namespace IntelIppTL
 
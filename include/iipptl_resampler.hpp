@@ -0,0 +1,261 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_RESAMPLER_HPP
+#define IIPPTL_RESAMPLER_HPP
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "iipptl_allocator.hpp"
+#include "iipptl_fir_design.hpp"
+#include "iipptl_fir_init.hpp"
+#include "iipptl_vector.hpp"
+
+namespace IntelIppTL {
+
+// Streaming polyphase L/M resampler over ippsFIRMR. Input blocks of any
+// size up to blockSize are accepted: samples that do not fill a whole
+// down-factor iteration are kept and prepended to the next block.
+template <typename IppType>
+class CIppResampler {
+  using CustomDeleter = std::function<decltype(CIppAllocator::deallocate)>;
+  using UniquePtr = std::unique_ptr<Ipp8u[], CustomDeleter>;
+
+ public:
+  using ValueType = IppType;
+  using IppVector = CIppVector<IppType>;
+  using SizeType = typename IppVector::SizeType;
+  using FIRSpec = decltype(Detail::CIppFIRSpec<IppType>::pointer());
+  CIppResampler() = default;
+  CIppResampler(SizeType blockSize, SizeType upFactor, SizeType downFactor,
+                SizeType channels = 1, SizeType tapsPerPhase = 16) {
+    if (blockSize <= 0 || upFactor <= 0 || downFactor <= 0 ||
+        channels <= 0 || tapsPerPhase <= 0) {
+      throw std::invalid_argument("CIppResampler: invalid ctor argument");
+    }
+    auto const divisor{std::gcd(upFactor, downFactor)};
+    upFactor /= divisor;
+    downFactor /= divisor;
+    auto const factor{std::max(upFactor, downFactor)};
+    auto const tapsSize{std::max(5, tapsPerPhase * factor)};
+    // Cut off slightly below the narrower Nyquist band so that the
+    // transition band does not fold back.
+    auto const frequency{0.45 / factor};
+    init(blockSize, upFactor, downFactor, channels,
+         ippFIRTaps<IppType>(ippFIRGenLowpass(frequency, tapsSize), upFactor));
+  }
+  CIppResampler(SizeType blockSize, SizeType upFactor, SizeType downFactor,
+                IppVector const &taps, SizeType channels = 1) {
+    if (blockSize <= 0 || upFactor <= 0 || downFactor <= 0 ||
+        channels <= 0 || taps.size() <= 0) {
+      throw std::invalid_argument("CIppResampler: invalid ctor argument");
+    }
+    init(blockSize, upFactor, downFactor, channels, taps);
+  }
+  CIppResampler(CIppResampler const &other) { operator=(other); }
+  CIppResampler(CIppResampler &&) noexcept = default;
+  CIppResampler &operator=(CIppResampler const &other) {
+    if (this != &other && other.m_Taps.size() > 0) {
+      auto tmp{CIppResampler(other.m_BlockSize, other.m_UpFactor,
+                             other.m_DownFactor, other.m_Taps,
+                             other.channels())};
+      tmp.m_Delay = other.m_Delay;
+      tmp.m_Pending = other.m_Pending;
+      tmp.m_PendingSize = other.m_PendingSize;
+      tmp.m_DestVector = other.m_DestVector;
+      tmp.m_DestSize = other.m_DestSize;
+      std::swap(*this, tmp);
+    } else if (this != &other) {
+      *this = CIppResampler{};
+    }
+    return *this;
+  }
+  CIppResampler &operator=(CIppResampler &&) noexcept = default;
+  virtual ~CIppResampler() noexcept = default;
+  void reset() {
+    for (auto &delay : m_Delay) {
+      delay.clear();
+    }
+    std::fill(m_PendingSize.begin(), m_PendingSize.end(), 0);
+    std::fill(m_DestSize.begin(), m_DestSize.end(), 0);
+  }
+  // Output size of the next call on the channel for a block of given size.
+  SizeType outputSize(SizeType size, SizeType channel = 0) const {
+    return (m_PendingSize.at(channel) + size) / m_DownFactor * m_UpFactor;
+  }
+  SizeType maxOutputSize() const noexcept {
+    return (m_BlockSize + m_DownFactor - 1) / m_DownFactor * m_UpFactor;
+  }
+  SizeType process(IppType const *source, SizeType size, IppType *dest,
+                   SizeType channel = 0) {
+    if (size < 0 || size > m_BlockSize) {
+      throw std::out_of_range("CIppResampler: block size out of range");
+    }
+    auto &pendingSize{m_PendingSize.at(channel)};
+    auto *delay{m_Delay[channel].begin()};
+    auto *spec{m_pFIRSpec};
+    auto *buffer{m_MemBuffer.get()};
+    if (pendingSize == 0 && size % m_DownFactor == 0) {
+      auto const iterations{size / m_DownFactor};
+      if (iterations > 0) {
+        IPP_CHECK_STATUS(m_ippsFIRMR(source, dest, iterations, spec, delay,
+                                     delay, buffer));
+      }
+      return iterations * m_UpFactor;
+    }
+    auto *pending{m_Pending[channel].begin()};
+    if (size > 0) {
+      IPP_CHECK_STATUS(m_ippsCopy(source, pending + pendingSize, size));
+    }
+    auto const total{pendingSize + size};
+    auto const iterations{total / m_DownFactor};
+    auto const consumed{iterations * m_DownFactor};
+    if (iterations > 0) {
+      IPP_CHECK_STATUS(m_ippsFIRMR(pending, dest, iterations, spec, delay,
+                                   delay, buffer));
+    }
+    if (iterations > 0 && total > consumed) {
+      IPP_CHECK_STATUS(
+          m_ippsCopy(pending + consumed, pending, total - consumed));
+    }
+    pendingSize = total - consumed;
+    return iterations * m_UpFactor;
+  }
+  SizeType process(IppVector const &source, SizeType channel = 0) {
+    auto &destSize{m_DestSize.at(channel)};
+    destSize = process(source.begin(), source.size(),
+                       m_DestVector[channel].begin(), channel);
+    return destSize;
+  }
+  SizeType process(IppVector const &source, IppVector &dest,
+                   SizeType channel = 0) {
+    if (dest.size() < outputSize(source.size(), channel)) {
+      throw std::out_of_range("CIppResampler: dest vector is too small");
+    }
+    return process(source.begin(), source.size(), dest.begin(), channel);
+  }
+  void process(std::vector<IppVector> const &sources) {
+    if (SizeType(sources.size()) != channels()) {
+      throw std::invalid_argument("CIppResampler: invalid channels count");
+    }
+    for (SizeType channel{}; channel < channels(); ++channel) {
+      process(sources[channel], channel);
+    }
+  }
+  inline IppType const *data(SizeType channel = 0) const {
+    return m_DestVector.at(channel).begin();
+  }
+  inline SizeType size(SizeType channel = 0) const {
+    return m_DestSize.at(channel);
+  }
+  inline SizeType channels() const noexcept {
+    return SizeType(m_Delay.size());
+  }
+  inline SizeType blockSize() const noexcept { return m_BlockSize; }
+  inline SizeType upFactor() const noexcept { return m_UpFactor; }
+  inline SizeType downFactor() const noexcept { return m_DownFactor; }
+  inline IppVector const &taps() const noexcept { return m_Taps; }
+
+ private:
+  void init(SizeType blockSize, SizeType upFactor, SizeType downFactor,
+            SizeType channels, IppVector const &taps) {
+    m_BlockSize = blockSize;
+    m_UpFactor = upFactor;
+    m_DownFactor = downFactor;
+    m_Taps = taps;
+    auto const dataType{Detail::CIppFIRSpec<IppType>::dataType()};
+    int specSize{}, bufferSize{};
+    IPP_CHECK_STATUS(ippsFIRMRGetSize(taps.size(), upFactor, downFactor,
+                                      dataType, dataType, &specSize,
+                                      &bufferSize));
+    auto memSpecTmp{UniquePtr{CIppAllocator::allocate<Ipp8u>(specSize),
+                              CIppAllocator::deallocate}};
+    m_MemSpec.swap(memSpecTmp);
+    auto memBufferTmp{UniquePtr{CIppAllocator::allocate<Ipp8u>(bufferSize),
+                                CIppAllocator::deallocate}};
+    m_MemBuffer.swap(memBufferTmp);
+    m_pFIRSpec = reinterpret_cast<FIRSpec>(m_MemSpec.get());
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      IPP_CHECK_STATUS(ippsFIRMRInit_64f(m_Taps.begin(), m_Taps.size(),
+                                         upFactor, 0, downFactor, 0,
+                                         m_pFIRSpec));
+      m_ippsFIRMR = ippsFIRMR_64f;
+      m_ippsCopy = ippsCopy_64f;
+    } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
+      IPP_CHECK_STATUS(ippsFIRMRInit_64fc(m_Taps.begin(), m_Taps.size(),
+                                          upFactor, 0, downFactor, 0,
+                                          m_pFIRSpec));
+      m_ippsFIRMR = ippsFIRMR_64fc;
+      m_ippsCopy = ippsCopy_64fc;
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      IPP_CHECK_STATUS(ippsFIRMRInit_32f(m_Taps.begin(), m_Taps.size(),
+                                         upFactor, 0, downFactor, 0,
+                                         m_pFIRSpec));
+      m_ippsFIRMR = ippsFIRMR_32f;
+      m_ippsCopy = ippsCopy_32f;
+    } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
+      IPP_CHECK_STATUS(ippsFIRMRInit_32fc(m_Taps.begin(), m_Taps.size(),
+                                          upFactor, 0, downFactor, 0,
+                                          m_pFIRSpec));
+      m_ippsFIRMR = ippsFIRMR_32fc;
+      m_ippsCopy = ippsCopy_32fc;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    auto const delaySize{(taps.size() + upFactor - 1) / upFactor};
+    m_Delay.assign(channels, IppVector(delaySize));
+    m_Pending.assign(channels, IppVector(blockSize + downFactor));
+    m_PendingSize.assign(channels, 0);
+    m_DestVector.assign(channels, IppVector(maxOutputSize() + upFactor));
+    m_DestSize.assign(channels, 0);
+    reset();
+  }
+
+  SizeType m_BlockSize{};
+  SizeType m_UpFactor{1};
+  SizeType m_DownFactor{1};
+  IppVector m_Taps{};
+  FIRSpec m_pFIRSpec{};
+  UniquePtr m_MemSpec{};
+  UniquePtr m_MemBuffer{};
+  std::function<IppStatus(IppType const *, IppType *, int, FIRSpec,
+                          IppType const *, IppType *, Ipp8u *)>
+      m_ippsFIRMR{};
+  std::function<IppStatus(IppType const *, IppType *, int)> m_ippsCopy{};
+  std::vector<IppVector> m_Delay{};
+  std::vector<IppVector> m_Pending{};
+  std::vector<SizeType> m_PendingSize{};
+  std::vector<IppVector> m_DestVector{};
+  std::vector<SizeType> m_DestSize{};
+};
+
+using CIppResampler64f = CIppResampler<Ipp64f>;
+using CIppResampler64fc = CIppResampler<Ipp64fc>;
+using CIppResampler32f = CIppResampler<Ipp32f>;
+using CIppResampler32fc = CIppResampler<Ipp32fc>;
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_RESAMPLER_HPP
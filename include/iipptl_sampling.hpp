@@ -19,37 +19,172 @@
 #ifndef IIPPTL_SAMPLING_HPP
 #define IIPPTL_SAMPLING_HPP
 
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
 #include "iipptl_vector.hpp"
 
 namespace IntelIppTL {
 
-// FIXME: не реализован.
+enum class IppSamplingMode { Down, Up };
+
+namespace Private {
 
 template <typename IppType>
-void ippSampleDown(CIppVector<IppType> const &source, CIppVector<IppType> &dest,
-                   int factor, int phase) {
-  // TODO: Добавить проверку на достаточность размера принимающего вектора.
-  //  if (source.size() != dest.size()) {
-  //    throw std::invalid_argument("vectors size is not equal");
-  //  }
+auto ippsSampleFunction(IppSamplingMode mode) {
   std::function<IppStatus(IppType const *, int, IppType *, int *, int, int *)>
-      ippsSampleUp{};
+      ippsSample{};
   if constexpr (std::is_same_v<IppType, Ipp64f>) {
-    ippsSampleDown = ippsSampleDown_64f;
+    ippsSample = mode == IppSamplingMode::Down ? ippsSampleDown_64f
+                                               : ippsSampleUp_64f;
   } else if constexpr (std::is_same_v<IppType, Ipp64fc>) {
-    ippsSampleDown = ippsSampleDown_64fc;
+    ippsSample = mode == IppSamplingMode::Down ? ippsSampleDown_64fc
+                                               : ippsSampleUp_64fc;
   } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
-    ippsSampleDown = ippsSampleDown_32f;
+    ippsSample = mode == IppSamplingMode::Down ? ippsSampleDown_32f
+                                               : ippsSampleUp_32f;
   } else if constexpr (std::is_same_v<IppType, Ipp32fc>) {
-    ippsSampleDown = ippsSampleDown_32fc;
+    ippsSample = mode == IppSamplingMode::Down ? ippsSampleDown_32fc
+                                               : ippsSampleUp_32fc;
   } else {
     static_assert(std::is_void_v<IppType>, "unsupported type");
   }
+  return ippsSample;
+}
+
+inline int ippSampleSize(IppSamplingMode mode, int size, int factor,
+                         int phase) {
+  if (mode == IppSamplingMode::Up) {
+    return size * factor;
+  }
+  return (size + factor - 1 - phase) / factor;
+}
+
+inline void ippSampleCheck(int factor, int phase) {
+  if (factor <= 0 || phase < 0 || phase >= factor) {
+    throw std::invalid_argument("ippSample: invalid factor or phase");
+  }
+}
+
+}  // namespace Private
+
+// Returns the number of samples written to dest.
+template <typename IppType>
+int ippSampleDown(CIppVector<IppType> const &source, CIppVector<IppType> &dest,
+                  int factor, int phase = 0) {
+  Private::ippSampleCheck(factor, phase);
+  auto const mode{IppSamplingMode::Down};
+  if (dest.size() < Private::ippSampleSize(mode, source.size(), factor,
+                                           phase)) {
+    throw std::out_of_range("ippSampleDown: dest vector is too small");
+  }
+  int destSize{};
+  IPP_CHECK_STATUS(Private::ippsSampleFunction<IppType>(mode)(
+      source.begin(), source.size(), dest.begin(), &destSize, factor, &phase));
+  return destSize;
+}
+
+// Returns the number of samples written to dest.
+template <typename IppType>
+int ippSampleUp(CIppVector<IppType> const &source, CIppVector<IppType> &dest,
+                int factor, int phase = 0) {
+  Private::ippSampleCheck(factor, phase);
+  auto const mode{IppSamplingMode::Up};
+  if (dest.size() < Private::ippSampleSize(mode, source.size(), factor,
+                                           phase)) {
+    throw std::out_of_range("ippSampleUp: dest vector is too small");
+  }
   int destSize{};
-  IPP_CHECK_STATUS(ippsSampleDown(source.begin(), source.size(), dest.begin(),
-                                  &destSize, factor, &phase));
+  IPP_CHECK_STATUS(Private::ippsSampleFunction<IppType>(mode)(
+      source.begin(), source.size(), dest.begin(), &destSize, factor, &phase));
+  return destSize;
 }
 
+// Streaming decimator/expander: the phase returned by IPP is carried over
+// to the next block, so consecutive blocks behave as one long signal.
+template <typename IppType>
+class CIppSampler {
+ public:
+  using ValueType = IppType;
+  using IppVector = CIppVector<IppType>;
+  using SizeType = typename IppVector::SizeType;
+  CIppSampler() = default;
+  CIppSampler(SizeType blockSize, SizeType factor,
+              IppSamplingMode mode = IppSamplingMode::Down,
+              SizeType phase = 0)
+      : m_BlockSize{blockSize},
+        m_Factor{factor},
+        m_Phase{phase},
+        m_Mode{mode},
+        m_ippsSample{Private::ippsSampleFunction<IppType>(mode)} {
+    if (blockSize <= 0 || factor <= 0 || phase < 0 || phase >= factor) {
+      throw std::invalid_argument("CIppSampler: invalid ctor argument");
+    }
+    m_DestVector = IppVector(maxOutputSize());
+  }
+  CIppSampler(CIppSampler const &) = default;
+  CIppSampler(CIppSampler &&) noexcept = default;
+  CIppSampler &operator=(CIppSampler const &) = default;
+  CIppSampler &operator=(CIppSampler &&) noexcept = default;
+  virtual ~CIppSampler() noexcept = default;
+  void reset(SizeType phase = 0) {
+    if (phase < 0 || phase >= m_Factor) {
+      throw std::invalid_argument("CIppSampler: invalid reset argument");
+    }
+    m_Phase = phase;
+    m_DestSize = 0;
+  }
+  // Output size of the next call for a block of the given size.
+  SizeType outputSize(SizeType size) const noexcept {
+    return Private::ippSampleSize(m_Mode, size, m_Factor, m_Phase);
+  }
+  SizeType maxOutputSize() const noexcept {
+    if (m_Mode == IppSamplingMode::Up) {
+      return m_BlockSize * m_Factor;
+    }
+    return (m_BlockSize + m_Factor - 1) / m_Factor;
+  }
+  SizeType process(IppType const *source, SizeType size, IppType *dest) {
+    if (size < 0 || size > m_BlockSize) {
+      throw std::out_of_range("CIppSampler: block size out of range");
+    }
+    IPP_CHECK_STATUS(
+        m_ippsSample(source, size, dest, &m_DestSize, m_Factor, &m_Phase));
+    return m_DestSize;
+  }
+  SizeType process(IppVector const &source) {
+    return process(source.begin(), source.size(), m_DestVector.begin());
+  }
+  SizeType process(IppVector const &source, IppVector &dest) {
+    if (dest.size() < outputSize(source.size())) {
+      throw std::out_of_range("CIppSampler: dest vector is too small");
+    }
+    return process(source.begin(), source.size(), dest.begin());
+  }
+  inline IppType const *data() const noexcept { return m_DestVector.begin(); }
+  inline SizeType size() const noexcept { return m_DestSize; }
+  inline SizeType phase() const noexcept { return m_Phase; }
+  inline SizeType factor() const noexcept { return m_Factor; }
+  inline SizeType blockSize() const noexcept { return m_BlockSize; }
+  inline IppSamplingMode mode() const noexcept { return m_Mode; }
+
+ private:
+  SizeType m_BlockSize{};
+  SizeType m_Factor{1};
+  SizeType m_Phase{};
+  SizeType m_DestSize{};
+  IppSamplingMode m_Mode{IppSamplingMode::Down};
+  std::function<IppStatus(IppType const *, int, IppType *, int *, int, int *)>
+      m_ippsSample{};
+  IppVector m_DestVector{};
+};
+
+using CIppSampler64f = CIppSampler<Ipp64f>;
+using CIppSampler64fc = CIppSampler<Ipp64fc>;
+using CIppSampler32f = CIppSampler<Ipp32f>;
+using CIppSampler32fc = CIppSampler<Ipp32fc>;
+
 }  // namespace IntelIppTL
 
 #endif  // IIPPTL_SAMPLING_HPP
@@ -0,0 +1,231 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#ifndef IIPPTL_STATISTICS_HPP
+#define IIPPTL_STATISTICS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <future>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "iipptl_vector.hpp"
+
+namespace IntelIppTL {
+
+enum class IppStatisticsFlags : int {
+  Mean = 1,
+  StdDev = 2,
+  NormL2 = 4,
+  MinMax = 8,
+  All = Mean | StdDev | NormL2 | MinMax
+};
+
+constexpr IppStatisticsFlags operator|(IppStatisticsFlags a,
+                                       IppStatisticsFlags b) {
+  return IppStatisticsFlags(int(a) | int(b));
+}
+
+constexpr bool ippHasFlag(IppStatisticsFlags flags, IppStatisticsFlags flag) {
+  return (int(flags) & int(flag)) != 0;
+}
+
+template <typename IppType>
+struct IppStatistics {
+  double mean{};
+  double stdDev{};
+  double normL2{};
+  IppType min{};
+  int minIndex{};
+  IppType max{};
+  int maxIndex{};
+};
+
+namespace Private {
+
+inline constexpr int k_StatisticsBlockSize{4096};
+
+// Per-range moments are merged with Chan's pairwise update, so blocks and
+// threads can be combined in any order.
+template <typename IppType>
+struct IppStatisticsPartial {
+  int count{};
+  double mean{};
+  double m2{};
+  double sumSquares{};
+  IppType min{};
+  int minIndex{};
+  IppType max{};
+  int maxIndex{};
+};
+
+template <typename IppType>
+void ippStatisticsMerge(IppStatisticsPartial<IppType> &target,
+                        IppStatisticsPartial<IppType> const &source) {
+  if (source.count == 0) {
+    return;
+  }
+  if (target.count == 0) {
+    target = source;
+    return;
+  }
+  double const count{double(target.count) + source.count};
+  double const delta{source.mean - target.mean};
+  target.mean += delta * source.count / count;
+  target.m2 += source.m2 + delta * delta * target.count * source.count / count;
+  target.sumSquares += source.sumSquares;
+  if (source.min < target.min) {
+    target.min = source.min;
+    target.minIndex = source.minIndex;
+  }
+  if (source.max > target.max) {
+    target.max = source.max;
+    target.maxIndex = source.maxIndex;
+  }
+  target.count += source.count;
+}
+
+template <typename IppType>
+auto ippStatisticsBlock(IppType const *data, int offset, int size,
+                        IppStatisticsFlags flags) {
+  IppStatisticsPartial<IppType> partial{};
+  partial.count = size;
+  if (size == 1) {
+    partial.mean = data[offset];
+    partial.sumSquares = partial.mean * partial.mean;
+    partial.min = partial.max = data[offset];
+    partial.minIndex = partial.maxIndex = offset;
+    return partial;
+  }
+  auto const *block{data + offset};
+  if (ippHasFlag(flags, IppStatisticsFlags::StdDev)) {
+    IppType mean{}, stdDev{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      IPP_CHECK_STATUS(ippsMeanStdDev_64f(block, size, &mean, &stdDev));
+    } else {
+      IPP_CHECK_STATUS(
+          ippsMeanStdDev_32f(block, size, &mean, &stdDev, ippAlgHintAccurate));
+    }
+    partial.mean = mean;
+    partial.m2 = double(stdDev) * stdDev * (size - 1);
+    partial.sumSquares = partial.m2 + partial.mean * partial.mean * size;
+  } else if (ippHasFlag(flags, IppStatisticsFlags::Mean)) {
+    IppType mean{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      IPP_CHECK_STATUS(ippsMean_64f(block, size, &mean));
+    } else {
+      IPP_CHECK_STATUS(ippsMean_32f(block, size, &mean, ippAlgHintAccurate));
+    }
+    partial.mean = mean;
+  }
+  if (ippHasFlag(flags, IppStatisticsFlags::NormL2) &&
+      !ippHasFlag(flags, IppStatisticsFlags::StdDev)) {
+    IppType norm{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      IPP_CHECK_STATUS(ippsNorm_L2_64f(block, size, &norm));
+    } else {
+      IPP_CHECK_STATUS(ippsNorm_L2_32f(block, size, &norm));
+    }
+    partial.sumSquares = double(norm) * norm;
+  }
+  if (ippHasFlag(flags, IppStatisticsFlags::MinMax)) {
+    std::function<IppStatus(IppType const *, int, IppType *, int *, IppType *,
+                            int *)>
+        ippsMinMaxIndx{};
+    if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      ippsMinMaxIndx = ippsMinMaxIndx_64f;
+    } else {
+      ippsMinMaxIndx = ippsMinMaxIndx_32f;
+    }
+    IPP_CHECK_STATUS(ippsMinMaxIndx(block, size, &partial.min,
+                                    &partial.minIndex, &partial.max,
+                                    &partial.maxIndex));
+    partial.minIndex += offset;
+    partial.maxIndex += offset;
+  }
+  return partial;
+}
+
+// Walks [begin, end) in cache-sized blocks; the last block absorbs the
+// remainder so that IPP never sees a single-element block.
+template <typename IppType>
+auto ippStatisticsRange(IppType const *data, int begin, int end,
+                        IppStatisticsFlags flags) {
+  IppStatisticsPartial<IppType> result{};
+  auto const blocks{std::max(1, (end - begin) / k_StatisticsBlockSize)};
+  for (int block{}; block < blocks; ++block) {
+    auto const offset{begin + block * k_StatisticsBlockSize};
+    auto const size{block + 1 == blocks ? end - offset
+                                        : k_StatisticsBlockSize};
+    ippStatisticsMerge(result, ippStatisticsBlock(data, offset, size, flags));
+  }
+  return result;
+}
+
+}  // namespace Private
+
+template <typename IppType>
+auto ippStatistics(CIppVector<IppType> const &source,
+                   IppStatisticsFlags flags = IppStatisticsFlags::All,
+                   int threads = 1) {
+  static_assert(std::is_same_v<IppType, Ipp64f> ||
+                    std::is_same_v<IppType, Ipp32f>,
+                "unsupported type");
+  auto const size{source.size()};
+  if (size < 1) {
+    throw std::invalid_argument("ippStatistics: empty vector");
+  }
+  auto const *data{source.begin()};
+  threads = std::clamp(threads, 1,
+                       std::max(1, size / Private::k_StatisticsBlockSize));
+  Private::IppStatisticsPartial<IppType> partial{};
+  if (threads == 1) {
+    partial = Private::ippStatisticsRange(data, 0, size, flags);
+  } else {
+    std::vector<std::future<Private::IppStatisticsPartial<IppType>>> futures{};
+    auto const step{size / threads};
+    for (int thread{}; thread < threads; ++thread) {
+      auto const begin{thread * step};
+      auto const end{thread + 1 == threads ? size : begin + step};
+      futures.push_back(std::async(std::launch::async, [=] {
+        return Private::ippStatisticsRange(data, begin, end, flags);
+      }));
+    }
+    for (auto &future : futures) {
+      Private::ippStatisticsMerge(partial, future.get());
+    }
+  }
+  IppStatistics<IppType> result{};
+  result.mean = partial.mean;
+  if (partial.count > 1) {
+    result.stdDev = std::sqrt(partial.m2 / (partial.count - 1));
+  }
+  result.normL2 = std::sqrt(partial.sumSquares);
+  result.min = partial.min;
+  result.minIndex = partial.minIndex;
+  result.max = partial.max;
+  result.maxIndex = partial.maxIndex;
+  return result;
+}
+
+}  // namespace IntelIppTL
+
+#endif  // IIPPTL_STATISTICS_HPP
@@ -19,6 +19,15 @@
 #ifndef IIPPTL_THRESHOLD_HPP
 #define IIPPTL_THRESHOLD_HPP
 
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include "iipptl_vector.hpp"
 
 namespace IntelIppTL {
@@ -64,6 +73,431 @@ void ippThreshold(CIppVector<IppType> &vector, IppType level, IppType value) {
       ippsThreshold_LTVal(vector.begin(), vector.size(), level, value));
 }
 
+enum class IppCFARMode { CellAveraging, GreatestOf, OrderedStatistic };
+
+// Constant false alarm rate detector. The noise around each cell is
+// estimated from training cells on both sides, skipping the guard cells
+// next to it, and the cell is reported when it exceeds factor * noise.
+// Near the edges only the side that fits is used. Cell-averaging and
+// greatest-of take their window sums from one prefix sum in O(N);
+// ordered-statistic picks the rank-th smallest training cell.
+class CIppCFAR {
+ public:
+  using ValueType = Ipp32f;
+  using IppVector = CIppVector32f;
+  using SizeType = typename IppVector::SizeType;
+  CIppCFAR() = default;
+  CIppCFAR(SizeType size, SizeType guard, SizeType training, Ipp32f factor,
+           IppCFARMode mode = IppCFARMode::CellAveraging, SizeType rank = 0)
+      : m_Guard{guard},
+        m_Training{training},
+        m_Rank{rank > 0 ? rank : 3 * training / 2},
+        m_Factor{factor},
+        m_Mode{mode} {
+    if (size <= 0 || guard < 0 || training <= 0 || factor <= 0 ||
+        m_Rank > 2 * training) {
+      throw std::invalid_argument("CIppCFAR: invalid ctor argument");
+    }
+    m_Noise = CIppVector64f(size);
+    if (mode == IppCFARMode::OrderedStatistic) {
+      m_Cells.resize(2 * training);
+    } else {
+      m_Prefix = CIppVector64f(size + 1);
+      m_Window = CIppVector64f(size);
+    }
+  }
+  CIppCFAR(CIppCFAR const &) = default;
+  CIppCFAR(CIppCFAR &&) noexcept = default;
+  CIppCFAR &operator=(CIppCFAR const &) = default;
+  CIppCFAR &operator=(CIppCFAR &&) noexcept = default;
+  virtual ~CIppCFAR() noexcept = default;
+  // Writes detection indices and their signal-to-noise ratios (linear)
+  // and returns how many were written; stops when the buffers are full.
+  SizeType detect(IppVector const &source, CIppVector32s &indices,
+                  IppVector &snr) {
+    if (source.size() != size() || indices.size() != snr.size()) {
+      throw std::invalid_argument("CIppCFAR: invalid argument");
+    }
+    if (m_Mode == IppCFARMode::OrderedStatistic) {
+      orderedNoise(source);
+    } else {
+      averagedNoise(source);
+    }
+    auto const *noise{m_Noise.begin()};
+    SizeType count{};
+    for (SizeType cell{}; cell < size() && count < indices.size(); ++cell) {
+      if (source[cell] > m_Factor * noise[cell]) {
+        indices[count] = cell;
+        snr[count] = Ipp32f(source[cell] / noise[cell]);
+        ++count;
+      }
+    }
+    return count;
+  }
+  inline SizeType size() const noexcept { return m_Noise.size(); }
+  inline SizeType guard() const noexcept { return m_Guard; }
+  inline SizeType training() const noexcept { return m_Training; }
+  inline IppCFARMode mode() const noexcept { return m_Mode; }
+
+ private:
+  void averagedNoise(IppVector const &source) {
+    auto const n{size()}, t{m_Training}, span{m_Guard + m_Training};
+    auto *prefix{m_Prefix.begin()};
+    auto *window{m_Window.begin()};
+    auto *noise{m_Noise.begin()};
+    prefix[0] = 0;
+    for (SizeType cell{}; cell < n; ++cell) {
+      prefix[cell + 1] = prefix[cell] + source[cell];
+    }
+    // window[j] sums the t cells starting at j.
+    if (n >= t) {
+      IPP_CHECK_STATUS(ippsSub_64f(prefix, prefix + t, window, n - t + 1));
+    }
+    auto const lead{span + m_Guard + 1};
+    auto const inner{n - 2 * span};
+    if (inner > 0) {
+      if (m_Mode == IppCFARMode::CellAveraging) {
+        IPP_CHECK_STATUS(
+            ippsAdd_64f(window, window + lead, noise + span, inner));
+        IPP_CHECK_STATUS(ippsMulC_64f_I(0.5 / t, noise + span, inner));
+      } else {
+        IPP_CHECK_STATUS(ippsMaxEvery_64f(window, window + lead, noise + span,
+                                          Ipp32u(inner)));
+        IPP_CHECK_STATUS(ippsMulC_64f_I(1. / t, noise + span, inner));
+      }
+    }
+    auto const edge{[&](SizeType cell) {
+      auto const lagging{cell - span >= 0};
+      auto const leading{cell + m_Guard + 1 + t <= n};
+      if (!lagging && !leading) {
+        return std::numeric_limits<double>::infinity();
+      }
+      return window[lagging ? cell - span : cell + m_Guard + 1] / t;
+    }};
+    for (SizeType cell{}; cell < std::min(span, n); ++cell) {
+      noise[cell] = edge(cell);
+    }
+    for (SizeType cell{std::max(span, n - span)}; cell < n; ++cell) {
+      noise[cell] = edge(cell);
+    }
+  }
+  void orderedNoise(IppVector const &source) {
+    auto const n{size()}, span{m_Guard + m_Training};
+    for (SizeType cell{}; cell < n; ++cell) {
+      auto last{m_Cells.begin()};
+      if (cell - span >= 0) {
+        last = std::copy(source.begin() + cell - span,
+                         source.begin() + cell - m_Guard, last);
+      }
+      if (cell + span < n) {
+        last = std::copy(source.begin() + cell + m_Guard + 1,
+                         source.begin() + cell + span + 1, last);
+      }
+      auto const cells{SizeType(last - m_Cells.begin())};
+      if (cells == 0) {
+        m_Noise[cell] = std::numeric_limits<double>::infinity();
+        continue;
+      }
+      // One-sided windows keep the same relative rank.
+      auto const rank{std::max<SizeType>(1, m_Rank * cells / (2 * m_Training))};
+      auto nth{m_Cells.begin() + rank - 1};
+      std::nth_element(m_Cells.begin(), nth, last);
+      m_Noise[cell] = *nth;
+    }
+  }
+
+  SizeType m_Guard{};
+  SizeType m_Training{};
+  SizeType m_Rank{};
+  Ipp32f m_Factor{};
+  IppCFARMode m_Mode{IppCFARMode::CellAveraging};
+  CIppVector64f m_Prefix{};
+  CIppVector64f m_Window{};
+  CIppVector64f m_Noise{};
+  std::vector<Ipp32f> m_Cells{};
+};
+
+namespace Private {
+
+inline constexpr int k_PeakChunkSize{256};
+
+}  // namespace Private
+
+// Collects the cells above a level into index/value buffers. Chunks whose
+// maximum does not reach the level are skipped with one vectorized
+// reduction, so sparse spectra cost little more than a max scan. Optional
+// constraints: local maxima only (a plateau reports its first cell), a
+// minimum distance between peaks (the higher one wins) and the topK
+// highest peaks. Results are ordered by index.
+template <typename IppType>
+class CIppPeakFinder {
+ public:
+  using ValueType = IppType;
+  using IppVector = CIppVector<IppType>;
+  using SizeType = typename IppVector::SizeType;
+  CIppPeakFinder() = default;
+  CIppPeakFinder(SizeType size, bool localMaximum = false,
+                 SizeType separation = 0, SizeType topK = 0)
+      : m_Size{size},
+        m_LocalMaximum{localMaximum},
+        m_Separation{separation},
+        m_TopK{topK} {
+    if (size <= 0 || separation < 0 || topK < 0) {
+      throw std::invalid_argument("CIppPeakFinder: invalid ctor argument");
+    }
+    if (separation > 1 || topK > 0) {
+      m_Candidates.reserve(size);
+      m_Order.reserve(size);
+      m_Kept.reserve(size);
+      m_Suppressed.reserve(size);
+    }
+  }
+  CIppPeakFinder(CIppPeakFinder const &) = default;
+  CIppPeakFinder(CIppPeakFinder &&) noexcept = default;
+  CIppPeakFinder &operator=(CIppPeakFinder const &) = default;
+  CIppPeakFinder &operator=(CIppPeakFinder &&) noexcept = default;
+  virtual ~CIppPeakFinder() noexcept = default;
+  // Returns how many peaks were written; without topK the scan stops when
+  // the buffers are full.
+  SizeType find(IppVector const &source, IppType level,
+                CIppVector32s &indices, IppVector &values) {
+    if (source.size() > m_Size || indices.size() != values.size()) {
+      throw std::invalid_argument("CIppPeakFinder: invalid argument");
+    }
+    if (indices.size() == 0) {
+      return 0;
+    }
+    if (m_Separation <= 1 && m_TopK == 0) {
+      SizeType count{};
+      scan(source, level, [&](SizeType cell) {
+        indices[count] = cell;
+        values[count] = source[cell];
+        return ++count < indices.size();
+      });
+      return count;
+    }
+    m_Candidates.clear();
+    scan(source, level, [&](SizeType cell) {
+      m_Candidates.push_back(cell);
+      return true;
+    });
+    select(source);
+    auto const count{std::min(SizeType(m_Kept.size()), indices.size())};
+    for (SizeType peak{}; peak < count; ++peak) {
+      indices[peak] = m_Kept[peak];
+      values[peak] = source[m_Kept[peak]];
+    }
+    return count;
+  }
+  inline SizeType size() const noexcept { return m_Size; }
+
+ private:
+  template <typename Callback>
+  void scan(IppVector const &source, IppType level, Callback &&callback) {
+    std::function<IppStatus(IppType const *, int, IppType *)> ippsMax{};
+    if constexpr (std::is_same_v<IppType, Ipp16s>) {
+      ippsMax = ippsMax_16s;
+    } else if constexpr (std::is_same_v<IppType, Ipp32s>) {
+      ippsMax = ippsMax_32s;
+    } else if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      ippsMax = ippsMax_32f;
+    } else if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      ippsMax = ippsMax_64f;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    auto const size{source.size()};
+    auto const *data{source.begin()};
+    for (SizeType chunk{}; chunk < size; chunk += Private::k_PeakChunkSize) {
+      auto const end{std::min(size, chunk + Private::k_PeakChunkSize)};
+      IppType max{};
+      IPP_CHECK_STATUS(ippsMax(data + chunk, end - chunk, &max));
+      if (max <= level) {
+        continue;
+      }
+      for (SizeType cell{chunk}; cell < end; ++cell) {
+        auto const value{data[cell]};
+        if (value <= level) {
+          continue;
+        }
+        if (m_LocalMaximum &&
+            ((cell > 0 && value <= data[cell - 1]) ||
+             (cell + 1 < size && value < data[cell + 1]))) {
+          continue;
+        }
+        if (!callback(cell)) {
+          return;
+        }
+      }
+    }
+  }
+  void select(IppVector const &source) {
+    auto const candidates{SizeType(m_Candidates.size())};
+    auto const higher{[&](SizeType a, SizeType b) {
+      return source[m_Candidates[a]] > source[m_Candidates[b]];
+    }};
+    m_Order.resize(candidates);
+    for (SizeType candidate{}; candidate < candidates; ++candidate) {
+      m_Order[candidate] = candidate;
+    }
+    m_Kept.clear();
+    if (m_Separation <= 1) {
+      auto const topK{std::min(m_TopK, candidates)};
+      std::partial_sort(m_Order.begin(), m_Order.begin() + topK,
+                        m_Order.end(), higher);
+      for (SizeType peak{}; peak < topK; ++peak) {
+        m_Kept.push_back(m_Candidates[m_Order[peak]]);
+      }
+    } else {
+      // Greedy suppression from the highest peak down.
+      std::stable_sort(m_Order.begin(), m_Order.end(), higher);
+      m_Suppressed.assign(candidates, false);
+      for (auto candidate : m_Order) {
+        if (m_Suppressed[candidate]) {
+          continue;
+        }
+        auto const cell{m_Candidates[candidate]};
+        m_Kept.push_back(cell);
+        if (m_TopK > 0 && SizeType(m_Kept.size()) == m_TopK) {
+          break;
+        }
+        auto const near{[&](SizeType other) {
+          return std::abs(m_Candidates[other] - cell) < m_Separation;
+        }};
+        for (auto left{candidate - 1}; left >= 0 && near(left); --left) {
+          m_Suppressed[left] = true;
+        }
+        for (auto right{candidate + 1}; right < candidates && near(right);
+             ++right) {
+          m_Suppressed[right] = true;
+        }
+      }
+    }
+    std::sort(m_Kept.begin(), m_Kept.end());
+  }
+
+  SizeType m_Size{};
+  bool m_LocalMaximum{};
+  SizeType m_Separation{};
+  SizeType m_TopK{};
+  std::vector<SizeType> m_Candidates{};
+  std::vector<SizeType> m_Order{};
+  std::vector<SizeType> m_Kept{};
+  std::vector<bool> m_Suppressed{};
+};
+
+using CIppPeakFinder16s = CIppPeakFinder<Ipp16s>;
+using CIppPeakFinder32s = CIppPeakFinder<Ipp32s>;
+using CIppPeakFinder32f = CIppPeakFinder<Ipp32f>;
+using CIppPeakFinder64f = CIppPeakFinder<Ipp64f>;
+
+// Per-cell hysteresis with debounce: an idle cell turns active after
+// dwell consecutive frames above the high level and returns to idle after
+// dwell consecutive frames below the low level. The state is one flag and
+// one counter per cell; each frame costs two vectorized compares, a
+// branch-free counter update and a chunked scan that only visits chunks
+// in which some counter reached the dwell.
+template <typename IppType>
+class CIppHysteresis {
+ public:
+  using ValueType = IppType;
+  using IppVector = CIppVector<IppType>;
+  using SizeType = typename IppVector::SizeType;
+  CIppHysteresis() = default;
+  CIppHysteresis(SizeType size, IppType high, IppType low, SizeType dwell = 1)
+      : m_High{high},
+        m_Low{low},
+        m_Dwell{dwell},
+        m_Count(size),
+        m_Active(size),
+        m_Above(size),
+        m_Below(size) {
+    if (size <= 0 || low > high || dwell <= 0) {
+      throw std::invalid_argument("CIppHysteresis: invalid ctor argument");
+    }
+  }
+  CIppHysteresis(CIppHysteresis const &) = default;
+  CIppHysteresis(CIppHysteresis &&) noexcept = default;
+  CIppHysteresis &operator=(CIppHysteresis const &) = default;
+  CIppHysteresis &operator=(CIppHysteresis &&) noexcept = default;
+  virtual ~CIppHysteresis() noexcept = default;
+  void reset() {
+    m_Count.clear();
+    std::fill(m_Active.begin(), m_Active.end(), Ipp8u{});
+  }
+  // Writes the cells that turned active into rising and the ones that
+  // turned idle into falling and returns both counts. A transition that
+  // does not fit into its buffer stays armed and is reported by a later
+  // update even if its condition no longer holds; active() changes only
+  // when the transition is reported.
+  std::pair<SizeType, SizeType> update(IppVector const &frame,
+                                       CIppVector32s &rising,
+                                       CIppVector32s &falling) {
+    if (frame.size() != size()) {
+      throw std::invalid_argument("CIppHysteresis: invalid frame size");
+    }
+    std::function<IppStatus(IppType const *, IppType, Ipp8u *, int, IppCmpOp)>
+        ippsCompareC{};
+    if constexpr (std::is_same_v<IppType, Ipp32f>) {
+      ippsCompareC = ippsCompareC_32f;
+    } else if constexpr (std::is_same_v<IppType, Ipp64f>) {
+      ippsCompareC = ippsCompareC_64f;
+    } else {
+      static_assert(std::is_void_v<IppType>, "unsupported type");
+    }
+    IPP_CHECK_STATUS(ippsCompareC(frame.begin(), m_High, m_Above.data(),
+                                  size(), ippCmpGreater));
+    IPP_CHECK_STATUS(ippsCompareC(frame.begin(), m_Low, m_Below.data(),
+                                  size(), ippCmpLess));
+    auto *count{m_Count.begin()};
+    auto const *active{m_Active.data()};
+    auto const *above{m_Above.data()};
+    auto const *below{m_Below.data()};
+    for (SizeType cell{}; cell < size(); ++cell) {
+      Ipp32s const pending{(active[cell] ? below[cell] : above[cell]) != 0};
+      Ipp32s const armed{count[cell] >= m_Dwell};
+      count[cell] = std::min(count[cell] + 1, m_Dwell) & -(pending | armed);
+    }
+    std::pair<SizeType, SizeType> result{};
+    for (SizeType chunk{}; chunk < size(); chunk += Private::k_PeakChunkSize) {
+      auto const end{std::min(size(), chunk + Private::k_PeakChunkSize)};
+      Ipp32s max{};
+      IPP_CHECK_STATUS(ippsMax_32s(count + chunk, end - chunk, &max));
+      if (max < m_Dwell) {
+        continue;
+      }
+      for (SizeType cell{chunk}; cell < end; ++cell) {
+        if (count[cell] < m_Dwell) {
+          continue;
+        }
+        auto &edges{m_Active[cell] ? falling : rising};
+        auto &edgeCount{m_Active[cell] ? result.second : result.first};
+        if (edgeCount < edges.size()) {
+          edges[edgeCount++] = cell;
+          m_Active[cell] = !m_Active[cell];
+          count[cell] = 0;
+        }
+      }
+    }
+    return result;
+  }
+  inline bool active(SizeType cell) const { return m_Active.at(cell) != 0; }
+  inline SizeType size() const noexcept { return m_Count.size(); }
+  inline SizeType dwell() const noexcept { return m_Dwell; }
+
+ private:
+  IppType m_High{};
+  IppType m_Low{};
+  SizeType m_Dwell{};
+  CIppVector32s m_Count{};
+  std::vector<Ipp8u> m_Active{};
+  std::vector<Ipp8u> m_Above{};
+  std::vector<Ipp8u> m_Below{};
+};
+
+using CIppHysteresis32f = CIppHysteresis<Ipp32f>;
+using CIppHysteresis64f = CIppHysteresis<Ipp64f>;
+
 }  // namespace IntelIppTL
 
 #endif  // IIPPTL_THRESHOLD_HPP
@@ -57,6 +57,28 @@ inline void ippCheckStatus(IppStatus status, char const *const file, int line,
   }
 }
 
+template <typename IppType>
+struct IppBaseType {
+  using Type = IppType;
+};
+
+template <>
+struct IppBaseType<Ipp32fc> {
+  using Type = Ipp32f;
+};
+
+template <>
+struct IppBaseType<Ipp64fc> {
+  using Type = Ipp64f;
+};
+
+template <typename IppType>
+using IppBaseTypeT = typename IppBaseType<IppType>::Type;
+
+template <typename IppType>
+inline constexpr int ippComponents{
+    std::is_same_v<IppType, IppBaseTypeT<IppType>> ? 1 : 2};
+
 }  // namespace Private
 
 #define IPP_CHECK_STATUS(status) \
@@ -111,6 +133,13 @@ class CIppVector {
         ippsCopy = ippsCopy_16s;
       } else if constexpr (std::is_same_v<ElementType, Ipp16sc>) {
         ippsCopy = ippsCopy_16sc;
+      } else if constexpr (std::is_same_v<ElementType, Ipp8u>) {
+        ippsCopy = ippsCopy_8u;
+      } else if constexpr (Private::ippIsFloat16<ElementType>) {
+        ippsCopy = [](ElementType const *source, ElementType *dest, int size) {
+          return ippsCopy_16s(reinterpret_cast<Ipp16s const *>(source),
+                              reinterpret_cast<Ipp16s *>(dest), size);
+        };
       } else {
         static_assert(std::is_void_v<ElementType>, "unsupported type");
       }
@@ -164,6 +193,16 @@ class CIppVector {
       ippsSet = ippsSet_32f;
     } else if constexpr (std::is_same_v<ElementType, Ipp32fc>) {
       ippsSet = ippsSet_32fc;
+    } else if constexpr (std::is_same_v<ElementType, Ipp32s>) {
+      ippsSet = ippsSet_32s;
+    } else if constexpr (std::is_same_v<ElementType, Ipp32sc>) {
+      ippsSet = ippsSet_32sc;
+    } else if constexpr (std::is_same_v<ElementType, Ipp16s>) {
+      ippsSet = ippsSet_16s;
+    } else if constexpr (std::is_same_v<ElementType, Ipp16sc>) {
+      ippsSet = ippsSet_16sc;
+    } else if constexpr (std::is_same_v<ElementType, Ipp8u>) {
+      ippsSet = ippsSet_8u;
     } else {
       static_assert(std::is_void_v<ElementType>, "unsupported type");
     }
@@ -204,6 +243,13 @@ class CIppVector {
       ippsCopy = ippsCopy_16s;
     } else if constexpr (std::is_same_v<ElementType, Ipp16sc>) {
       ippsCopy = ippsCopy_16sc;
+    } else if constexpr (std::is_same_v<ElementType, Ipp8u>) {
+      ippsCopy = ippsCopy_8u;
+    } else if constexpr (Private::ippIsFloat16<ElementType>) {
+      ippsCopy = [](ElementType const *source, ElementType *dest, int size) {
+        return ippsCopy_16s(reinterpret_cast<Ipp16s const *>(source),
+                            reinterpret_cast<Ipp16s *>(dest), size);
+      };
     } else {
       static_assert(std::is_void_v<ElementType>, "unsupported type");
     }
@@ -626,6 +672,12 @@ class CIppVector {
       ippsZero = ippsZero_16s;
     } else if constexpr (std::is_same_v<ElementType, Ipp16sc>) {
       ippsZero = ippsZero_16sc;
+    } else if constexpr (std::is_same_v<ElementType, Ipp8u>) {
+      ippsZero = ippsZero_8u;
+    } else if constexpr (Private::ippIsFloat16<ElementType>) {
+      ippsZero = [](ElementType *data, int size) {
+        return ippsZero_16s(reinterpret_cast<Ipp16s *>(data), size);
+      };
     } else {
       static_assert(std::is_void_v<ElementType>, "unsupported type");
     }
@@ -669,6 +721,13 @@ class CIppVector {
       ippsCopy = ippsCopy_16s;
     } else if constexpr (std::is_same_v<ElementType, Ipp16sc>) {
       ippsCopy = ippsCopy_16sc;
+    } else if constexpr (std::is_same_v<ElementType, Ipp8u>) {
+      ippsCopy = ippsCopy_8u;
+    } else if constexpr (Private::ippIsFloat16<ElementType>) {
+      ippsCopy = [](ElementType const *source, ElementType *dest, int size) {
+        return ippsCopy_16s(reinterpret_cast<Ipp16s const *>(source),
+                            reinterpret_cast<Ipp16s *>(dest), size);
+      };
     } else {
       static_assert(std::is_void_v<ElementType>, "unsupported type");
     }
@@ -725,12 +784,54 @@ class CIppVector {
   UniquePtr m_Vector{};
 };
 
+namespace Private {
+
+template <typename IppType>
+void ippScale(IppBaseTypeT<IppType> value, IppType *data, int size) {
+  using BaseType = IppBaseTypeT<IppType>;
+  std::function<IppStatus(BaseType, BaseType *, int)> ippsMulC{};
+  if constexpr (std::is_same_v<BaseType, Ipp64f>) {
+    ippsMulC = ippsMulC_64f_I;
+  } else if constexpr (std::is_same_v<BaseType, Ipp32f>) {
+    ippsMulC = ippsMulC_32f_I;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsMulC(value, reinterpret_cast<BaseType *>(data),
+                            size * ippComponents<IppType>));
+}
+
+template <typename IppType>
+void ippAddScaled(IppType const *source, IppBaseTypeT<IppType> value,
+                  IppType *dest, int size) {
+  using BaseType = IppBaseTypeT<IppType>;
+  std::function<IppStatus(BaseType const *, BaseType, BaseType *, int)>
+      ippsAddProductC{};
+  if constexpr (std::is_same_v<BaseType, Ipp64f>) {
+    ippsAddProductC = ippsAddProductC_64f;
+  } else if constexpr (std::is_same_v<BaseType, Ipp32f>) {
+    ippsAddProductC = ippsAddProductC_32f;
+  } else {
+    static_assert(std::is_void_v<IppType>, "unsupported type");
+  }
+  IPP_CHECK_STATUS(ippsAddProductC(reinterpret_cast<BaseType const *>(source),
+                                   value, reinterpret_cast<BaseType *>(dest),
+                                   size * ippComponents<IppType>));
+}
+
+}  // namespace Private
+
 using CIppVector64f = CIppVector<Ipp64f>;
 using CIppVector64fc = CIppVector<Ipp64fc>;
 using CIppVector32f = CIppVector<Ipp32f>;
 using CIppVector32fc = CIppVector<Ipp32fc>;
 using CIppVector32s = CIppVector<Ipp32s>;
 using CIppVector32sc = CIppVector<Ipp32sc>;
+using CIppVector16s = CIppVector<Ipp16s>;
+using CIppVector16sc = CIppVector<Ipp16sc>;
+using CIppVector8u = CIppVector<Ipp8u>;
+using CIppVector16f = CIppVector<IppFloat16>;
+using CIppVector16bf = CIppVector<IppBFloat16>;
 
 }  // namespace IntelIppTL
 
@@ -28,3 +28,123 @@ class CIppAverageTest : public ::testing::Test {
 };
 
 TYPED_TEST_CASE_P(CIppAverageTest);
+
+TYPED_TEST_P(CIppAverageTest, Exponential) {
+  auto const vecSize{16};
+  auto average{
+      CIppAverage<TypeParam>(vecSize, 1000, IppAverageMode::Exponential)};
+  ASSERT_EQ(average.size(), 1000);
+  auto input{CIppVector<TypeParam>(vecSize)};
+  auto output{CIppVector<TypeParam>(vecSize)};
+  input = 5;
+  for (int i{}; i < 100000; ++i) {
+    average += input;
+    if (i % 9973 == 0) {
+      average.get(output);
+      ASSERT_NEAR(output[0], 5, 1e-3);
+    }
+  }
+  average.alpha(0.01);
+  average.reinit(2 * vecSize, average.size());
+  ASSERT_EQ(average.size(), 1000);
+  ASSERT_DOUBLE_EQ(average.alpha(), 0.01);
+}
+
+TYPED_TEST_P(CIppAverageTest, BoxcarDrift) {
+  auto const vecSize{4};
+  auto const averageSize{10};
+  auto average{CIppAverage<TypeParam>(vecSize, averageSize)};
+  auto input{CIppVector<TypeParam>(vecSize)};
+  auto output{CIppVector<TypeParam>(vecSize)};
+  auto value = [](int i) { return 1000.1 * ((i * 7919) % 13) + 0.37; };
+  for (int i{}; i < 200000; ++i) {
+    input = TypeParam(value(i));
+    average += input;
+  }
+  auto expected{0.};
+  for (int i{200000 - averageSize}; i < 200000; ++i) {
+    expected += TypeParam(value(i));
+  }
+  expected /= averageSize;
+  average.get(output);
+  ASSERT_NEAR(output[0], expected, expected * 1e-5);
+}
+
+TYPED_TEST_P(CIppAverageTest, SlidingMax) {
+  auto const vecSize{4};
+  auto const averageSize{5};
+  auto average{
+      CIppAverage<TypeParam>(vecSize, averageSize, IppAverageMode::SlidingMax)};
+  auto hold{CIppAverage<TypeParam>(vecSize, 1, IppAverageMode::MinHold)};
+  auto input{CIppVector<TypeParam>(vecSize)};
+  auto output{CIppVector<TypeParam>(vecSize)};
+  auto value = [](int i) { return TypeParam((i * 37) % 23); };
+  for (int i{}; i < 100; ++i) {
+    input = value(i);
+    average += input;
+    hold += input;
+    auto expected{value(i)};
+    for (int j{(i < averageSize) ? 0 : i - averageSize + 1}; j < i; ++j) {
+      expected = std::max(expected, value(j));
+    }
+    average.get(output);
+    ASSERT_EQ(output[0], expected);
+  }
+  hold.get(output);
+  ASSERT_EQ(output[0], 0);
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppAverageTest, Exponential, BoxcarDrift,
+                           SlidingMax);
+using IppTypes = ::testing::Types<Ipp32f, Ipp64f>;
+INSTANTIATE_TYPED_TEST_CASE_P(Average, CIppAverageTest, IppTypes);
+
+template <typename StorageType>
+class CIppAverageStorageTest : public ::testing::Test {
+ public:
+};
+
+TYPED_TEST_CASE_P(CIppAverageStorageTest);
+
+TYPED_TEST_P(CIppAverageStorageTest, Boxcar) {
+  auto const vecSize{4};
+  auto const averageSize{10};
+  auto average{CIppAverage<Ipp32f, TypeParam>(vecSize, averageSize)};
+  auto input{CIppVector32f(vecSize)};
+  auto output{CIppVector32f(vecSize)};
+  auto value = [](int i) { return Ipp32f((i * 37) % 23); };
+  for (int i{}; i < 1000; ++i) {
+    input = value(i);
+    average += input;
+  }
+  auto expected{0.f};
+  for (int i{1000 - averageSize}; i < 1000; ++i) {
+    expected += value(i);
+  }
+  average.get(output);
+  ASSERT_FLOAT_EQ(output[0], expected / averageSize);
+}
+
+TYPED_TEST_P(CIppAverageStorageTest, SlidingMax) {
+  auto const vecSize{4};
+  auto const averageSize{5};
+  auto average{CIppAverage<Ipp32f, TypeParam>(vecSize, averageSize,
+                                              IppAverageMode::SlidingMax)};
+  auto input{CIppVector32f(vecSize)};
+  auto output{CIppVector32f(vecSize)};
+  auto value = [](int i) { return Ipp32f((i * 37) % 23) - 11; };
+  for (int i{}; i < 100; ++i) {
+    input = value(i);
+    average += input;
+    auto expected{value(i)};
+    for (int j{(i < averageSize) ? 0 : i - averageSize + 1}; j < i; ++j) {
+      expected = std::max(expected, value(j));
+    }
+    average.get(output);
+    ASSERT_EQ(output[vecSize - 1], expected);
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppAverageStorageTest, Boxcar, SlidingMax);
+using StorageTypes = ::testing::Types<IppFloat16, IppBFloat16>;
+INSTANTIATE_TYPED_TEST_CASE_P(Average, CIppAverageStorageTest, StorageTypes);
@@ -28,3 +28,94 @@ class CIppConvertTest : public ::testing::Test {
 };
 
 TYPED_TEST_CASE_P(CIppConvertTest);
+
+TEST(CIppIngestTest, Formats) {
+  auto const size{2500};
+  auto source{CIppVector<Ipp16sc>(size)};
+  for (int i{}; i < size; ++i) {
+    source[i] = Ipp16sc{Ipp16s(i - 1000), Ipp16s(-i)};
+  }
+  auto dest{CIppVector32fc(size)};
+  ippIngest(source, dest, 0.5, Ipp32fc{10, 0});
+  ASSERT_FLOAT_EQ(dest[0].re, -505);
+  ASSERT_FLOAT_EQ(dest[size - 1].re, 744.5);
+  ASSERT_FLOAT_EQ(dest[size - 1].im, -1249.5);
+  Ipp8u const bytes[]{0x80, 0x7F, 0x00, 0xFF, 0x01, 0x80};
+  dest.resize(3);
+  ippIngest(bytes, sizeof(bytes), IppSampleFormat::UInt8, dest);
+  ASSERT_FLOAT_EQ(dest[0].im, -1);
+  ASSERT_FLOAT_EQ(dest[1].re, -128);
+  ASSERT_FLOAT_EQ(dest[1].im, 127);
+  ASSERT_FLOAT_EQ(dest[2].re, -127);
+  // I = 2047, Q = -2048, then I = -1, Q = 5.
+  Ipp8u const packed[]{0xFF, 0x07, 0x80, 0xFF, 0x5F, 0x00};
+  dest.resize(2);
+  ippIngest(packed, sizeof(packed), IppSampleFormat::Packed12, dest, 2);
+  ASSERT_FLOAT_EQ(dest[0].re, 4094);
+  ASSERT_FLOAT_EQ(dest[0].im, -4096);
+  ASSERT_FLOAT_EQ(dest[1].re, -2);
+  ASSERT_FLOAT_EQ(dest[1].im, 10);
+  dest.resize(3);
+  ASSERT_THROW(
+      ippIngest(packed, sizeof(packed), IppSampleFormat::Packed12, dest),
+      std::invalid_argument);
+  auto raw{CIppVector8u(sizeof(bytes))};
+  raw.assign(bytes, sizeof(bytes));
+  ippIngest(raw, IppSampleFormat::UInt8, dest);
+  ASSERT_FLOAT_EQ(dest[2].re, -127);
+}
+
+TEST(CIppConvertTest, Float16) {
+  auto const size{3};
+  auto source{CIppVector32f(size)};
+  source[0] = 0.1f;
+  source[1] = -65504;
+  source[2] = 1 + 1.f / 256;
+  auto half{CIppVector16f(size)};
+  auto brain{CIppVector16bf(size)};
+  auto dest{CIppVector32f(size)};
+  ippConvert(source, half);
+  ippConvert(half, dest);
+  ASSERT_FLOAT_EQ(dest[0], 0.0999755859375f);
+  ASSERT_FLOAT_EQ(dest[1], -65504);
+  ASSERT_FLOAT_EQ(dest[2], 1 + 1.f / 256);
+  ippConvert(source, brain);
+  ippConvert(brain, dest);
+  ASSERT_FLOAT_EQ(dest[0], 0.10009765625f);
+  ASSERT_FLOAT_EQ(dest[1], -65536);
+  // Halfway between two bfloat16 values: rounds to the even one.
+  ASSERT_FLOAT_EQ(dest[2], 1);
+}
+
+TEST(CIppConvertTest, Saturate) {
+  auto const size{4};
+  auto source{CIppVector32f(size)};
+  source[0] = 2.5f;
+  source[1] = -3.5f;
+  source[2] = 1e6f;
+  source[3] = -1e10f;
+  auto short16{CIppVector16s(size)};
+  ippConvert(source, short16);
+  ASSERT_EQ(short16[0], 2);
+  ASSERT_EQ(short16[1], -4);
+  ASSERT_EQ(short16[2], IPP_MAX_16S);
+  ASSERT_EQ(short16[3], IPP_MIN_16S);
+  ippConvert(source, short16, ippRndZero, -2);
+  ASSERT_EQ(short16[0], 10);
+  ASSERT_EQ(short16[1], -14);
+  auto int32{CIppVector32s(size)};
+  ippConvert(source, int32, ippRndFinancial, 1);
+  ASSERT_EQ(int32[0], 1);
+  ASSERT_EQ(int32[2], 500000);
+  ASSERT_EQ(int32[3], IPP_MIN_32S);
+  auto byte8{CIppVector8u(size)};
+  ippConvert(source, byte8);
+  ASSERT_EQ(byte8[0], 2);
+  ASSERT_EQ(byte8[1], 0);
+  ASSERT_EQ(byte8[2], IPP_MAX_8U);
+  auto complex{CIppVector32fc(size, Ipp32fc{40000.f, -0.75f})};
+  auto complex16{CIppVector16sc(size)};
+  ippConvert(complex, complex16, ippRndNear, -1);
+  ASSERT_EQ(complex16[3].re, IPP_MAX_16S);
+  ASSERT_EQ(complex16[3].im, -2);
+}
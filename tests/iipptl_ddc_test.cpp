@@ -0,0 +1,65 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include <cmath>
+
+#include "iipptl_ddc.hpp"
+
+using namespace IntelIppTL;
+
+TEST(CIppDDCTest, ToneToBaseband) {
+  auto const blockSize{4096};
+  auto const decimation{16};
+  auto const offset{0.002};
+  auto const twoPi{2 * std::acos(-1.)};
+  auto ddc{CIppDDC(blockSize, 0.1, decimation)};
+  auto source{CIppVector32fc(blockSize)};
+  auto phase{0.};
+  for (int block{}; block < 8; ++block) {
+    for (int i{}; i < blockSize; ++i) {
+      source[i] = {Ipp32f(std::cos(phase)), Ipp32f(std::sin(phase))};
+      phase = std::fmod(phase + twoPi * (0.1 + offset), twoPi);
+    }
+    ASSERT_EQ(ddc.process(source), blockSize / decimation);
+  }
+  auto const last{ddc.data()[ddc.size() - 1]};
+  auto const previous{ddc.data()[ddc.size() - 2]};
+  ASSERT_NEAR(std::hypot(last.re, last.im), 1, 1e-2);
+  auto const step{std::atan2(last.im, last.re) -
+                  std::atan2(previous.im, previous.re)};
+  ASSERT_NEAR(std::remainder(step, twoPi), twoPi * offset * decimation, 1e-2);
+}
+
+TEST(CIppDDCTest, Integer) {
+  auto const blockSize{4096};
+  auto ddc{CIppDDC(blockSize, -0.25, 8)};
+  auto source{CIppVector<Ipp16sc>(blockSize)};
+  for (int i{}; i < blockSize; i += 4) {
+    source[i] = {1000, 0};
+    source[i + 1] = {0, -1000};
+    source[i + 2] = {-1000, 0};
+    source[i + 3] = {0, 1000};
+  }
+  for (int block{}; block < 4; ++block) {
+    ddc.process(source);
+  }
+  auto const last{ddc.data()[ddc.size() - 1]};
+  ASSERT_NEAR(std::hypot(last.re, last.im), 1000, 10);
+}
@@ -18,6 +18,8 @@
 
 #include "pch.h"
 
+#include <limits>
+
 #include "iipptl_delay.hpp"
 
 using namespace IntelIppTL;
@@ -28,3 +30,40 @@ class CIppDelayTest : public ::testing::Test {
 };
 
 TYPED_TEST_CASE_P(CIppDelayTest);
+
+template <typename IppType>
+class CIppSampleDelayTest : public ::testing::Test {
+ public:
+};
+
+TYPED_TEST_CASE_P(CIppSampleDelayTest);
+
+TYPED_TEST_P(CIppSampleDelayTest, Delay) {
+  auto const blockSize{8};
+  auto const blocks{4};
+  auto delay{CIppSampleDelay<TypeParam>(blockSize, 5, 2)};
+  delay.setDelay(3, 0);
+  delay.setDelay(2.5, 1);
+  ASSERT_THROW(delay.setDelay(std::numeric_limits<double>::quiet_NaN()),
+               std::invalid_argument);
+  ASSERT_THROW(delay.setDelay(1e300), std::invalid_argument);
+  auto sources{std::vector<CIppVector<TypeParam>>(2, blockSize)};
+  auto dests{std::vector<CIppVector<TypeParam>>(2, blockSize)};
+  for (int block{}; block < blocks; ++block) {
+    for (int i{}; i < blockSize; ++i) {
+      sources[0][i] = sources[1][i] = TypeParam(block * blockSize + i);
+    }
+    delay.process(sources, dests);
+    for (int i{}; i < blockSize; ++i) {
+      auto const n{block * blockSize + i};
+      ASSERT_DOUBLE_EQ(dests[0][i], (n < 3) ? 0 : n - 3);
+      if (n >= 4) {
+        ASSERT_NEAR(dests[1][i], n - 2.5, 1e-4);
+      }
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppSampleDelayTest, Delay);
+using IppTypes = ::testing::Types<Ipp32f, Ipp64f>;
+INSTANTIATE_TYPED_TEST_CASE_P(SampleDelay, CIppSampleDelayTest, IppTypes);
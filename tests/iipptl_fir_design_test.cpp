@@ -0,0 +1,35 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include "iipptl_fir_design.hpp"
+
+using namespace IntelIppTL;
+
+TEST(CIppFIRDesignTest, Lowpass) {
+  auto const tapsSize{63};
+  auto taps{ippFIRGenLowpass(0.1, tapsSize)};
+  ASSERT_EQ(taps.size(), tapsSize);
+  ASSERT_NEAR(taps.sum(), 1, 1e-9);
+  ASSERT_NEAR(taps[0], taps[tapsSize - 1], 1e-12);
+  auto const complexTaps{ippFIRTaps<Ipp32fc>(taps, 2)};
+  ASSERT_NEAR(complexTaps[tapsSize / 2].re, 2 * taps[tapsSize / 2], 1e-6);
+  ASSERT_EQ(complexTaps[tapsSize / 2].im, 0);
+  ASSERT_THROW(ippFIRGenLowpass(0.6, tapsSize), std::invalid_argument);
+}
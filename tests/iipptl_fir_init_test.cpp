@@ -0,0 +1,52 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include "iipptl_fir_init.hpp"
+
+using namespace IntelIppTL;
+
+template <typename IppType>
+class CIppFIRInitTest : public ::testing::Test {
+ public:
+};
+
+TYPED_TEST_CASE_P(CIppFIRInitTest);
+
+TYPED_TEST_P(CIppFIRInitTest, Algorithm) {
+  auto const shortTaps{CIppVector<TypeParam>(16)};
+  auto const longTaps{CIppVector<TypeParam>(256)};
+  auto direct{Detail::CIppFIRInit<TypeParam>(shortTaps, 4096)};
+  ASSERT_EQ(direct.algorithm(), IppFIRAlgorithm::Direct);
+  auto fft{Detail::CIppFIRInit<TypeParam>(longTaps, 4096)};
+  ASSERT_EQ(fft.algorithm(), IppFIRAlgorithm::FFT);
+  ASSERT_NE(fft.firSpec(), nullptr);
+  fft.reinit(longTaps, 128);
+  ASSERT_EQ(fft.algorithm(), IppFIRAlgorithm::Direct);
+  auto const copy{fft};
+  ASSERT_NE(copy.firSpec(), fft.firSpec());
+  fft = Detail::CIppFIRInit<TypeParam>{};
+  direct = fft;
+  ASSERT_EQ(direct.firSpec(), nullptr);
+  ASSERT_EQ(direct.taps().size(), 0);
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppFIRInitTest, Algorithm);
+using IppTypes = ::testing::Types<Ipp64f, Ipp64fc, Ipp32f, Ipp32fc>;
+INSTANTIATE_TYPED_TEST_CASE_P(FIRInit, CIppFIRInitTest, IppTypes);
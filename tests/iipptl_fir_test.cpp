@@ -0,0 +1,58 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include "iipptl_fir.hpp"
+
+using namespace IntelIppTL;
+
+template <typename IppType>
+class CIppFIRTest : public ::testing::Test {
+ public:
+};
+
+TYPED_TEST_CASE_P(CIppFIRTest);
+
+TYPED_TEST_P(CIppFIRTest, ImpulseResponse) {
+  auto const tapsSize{100};
+  auto const blockSize{64};
+  auto taps{CIppVector<TypeParam>(tapsSize)};
+  for (int i{}; i < tapsSize; ++i) {
+    taps[i] = TypeParam(i + 1);
+  }
+  for (auto algorithm : {IppFIRAlgorithm::Direct, IppFIRAlgorithm::FFT}) {
+    auto fir{CIppFIR<TypeParam>(taps, blockSize, 2, algorithm)};
+    auto source{CIppVector<TypeParam>(blockSize)};
+    auto dest{CIppVector<TypeParam>(blockSize)};
+    for (int block{}; block < 2; ++block) {
+      source = 0;
+      if (block == 0) {
+        source[0] = 1;
+      }
+      fir.process(source, dest, 1);
+      for (int i{}; i < blockSize && block * blockSize + i < tapsSize; ++i) {
+        ASSERT_NEAR(dest[i], block * blockSize + i + 1, 1e-3);
+      }
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppFIRTest, ImpulseResponse);
+using IppTypes = ::testing::Types<Ipp64f, Ipp32f>;
+INSTANTIATE_TYPED_TEST_CASE_P(FIR, CIppFIRTest, IppTypes);
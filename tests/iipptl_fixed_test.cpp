@@ -0,0 +1,68 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include "iipptl_fixed.hpp"
+
+using namespace IntelIppTL;
+
+template <typename IppType>
+class CIppFixedTest : public ::testing::Test {
+ public:
+};
+
+TYPED_TEST_CASE_P(CIppFixedTest);
+
+TYPED_TEST_P(CIppFixedTest, ScaleFactor) {
+  auto const size{64};
+  auto sourceA{CIppVector<TypeParam>(size)};
+  auto sourceB{CIppVector<TypeParam>(size)};
+  auto dest{CIppVector<TypeParam>(size)};
+  sourceA = 100;
+  sourceB = 34;
+  ippAdd(sourceA, sourceB, dest, 1);
+  ASSERT_EQ(dest[0], TypeParam(67));
+  ippSub(sourceA, sourceB, dest, 0);
+  ASSERT_EQ(dest[size - 1], TypeParam(66));
+  ippMul(sourceA, sourceB, dest, 3);
+  ASSERT_EQ(dest[1], TypeParam(425));
+  ippMulC(sourceB, TypeParam(4), dest, -1);
+  ASSERT_EQ(dest[2], TypeParam(272));
+  ippSubC(dest, TypeParam(64), 2);
+  ASSERT_EQ(dest[3], TypeParam(52));
+  ippAdd(sourceA, dest, 0);
+  ASSERT_EQ(dest[4], TypeParam(152));
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppFixedTest, ScaleFactor);
+using IppTypes = ::testing::Types<Ipp16s, Ipp32s>;
+INSTANTIATE_TYPED_TEST_CASE_P(Fixed, CIppFixedTest, IppTypes);
+
+TEST(CIppFixedTest, Saturation) {
+  auto vector{CIppVector16s(16, 30000)};
+  ippAddC(vector, Ipp16s(30000), 0);
+  ASSERT_EQ(vector[0], IPP_MAX_16S);
+  vector = 30000;
+  ippAddC(vector, Ipp16s(30000), 1);
+  ASSERT_EQ(vector[15], 30000);
+  auto complex{CIppVector16sc(16, Ipp16sc{300, -400})};
+  ippMulC(complex, Ipp16sc{0, 2}, 1);
+  ASSERT_EQ(complex[0].re, 400);
+  ASSERT_EQ(complex[0].im, 300);
+}
@@ -0,0 +1,53 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include <cmath>
+
+#include "iipptl_hilbert.hpp"
+
+using namespace IntelIppTL;
+
+TEST(CIppHilbertTest, AnalyticTone) {
+  auto const blockSize{100};
+  auto const frequency{0.05};
+  auto const pi{std::acos(-1.)};
+  auto hilbert{CIppHilbert(blockSize)};
+  auto source{CIppVector32f(blockSize)};
+  auto dest{CIppVector32fc(blockSize)};
+  auto const delay{hilbert.groupDelay()};
+  auto offset{0};
+  for (int block{}; block < 4; ++block) {
+    // Uneven sizes exercise the delay line carried across blocks.
+    auto const size{block % 2 == 0 ? blockSize : blockSize - 37};
+    for (int i{}; i < size; ++i) {
+      source[i] = Ipp32f(std::cos(2 * pi * frequency * (offset + i)));
+    }
+    hilbert.process(source.begin(), dest.begin(), size);
+    for (int i{}; i < size; ++i) {
+      auto const n{offset + i - delay};
+      if (n < delay) {
+        continue;
+      }
+      ASSERT_NEAR(dest[i].re, std::cos(2 * pi * frequency * n), 1e-2);
+      ASSERT_NEAR(dest[i].im, std::sin(2 * pi * frequency * n), 1e-2);
+    }
+    offset += size;
+  }
+}
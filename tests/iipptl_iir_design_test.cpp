@@ -0,0 +1,48 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include "iipptl_iir_design.hpp"
+
+using namespace IntelIppTL;
+
+TEST(CIppIIRDesignTest, Butterworth) {
+  auto taps{ippIIRButterworth(5, 0.1)};
+  ASSERT_EQ(taps.size(), 3 * 6);
+  auto gain{1.};
+  for (int section{}; section < 3; ++section) {
+    auto const *biquad{taps.begin() + section * 6};
+    gain *= (biquad[0] + biquad[1] + biquad[2]) /
+            (biquad[3] + biquad[4] + biquad[5]);
+  }
+  ASSERT_NEAR(gain, 1, 1e-9);
+  ASSERT_THROW(ippIIRButterworth(4, 0.5), std::invalid_argument);
+}
+
+TEST(CIppIIRDesignTest, Chebyshev) {
+  auto taps{ippIIRChebyshev1(4, 0.1, 1, IppIIRType::Highpass)};
+  ASSERT_EQ(taps.size(), 2 * 6);
+  auto gain{1.};
+  for (int section{}; section < 2; ++section) {
+    auto const *biquad{taps.begin() + section * 6};
+    gain *= (biquad[0] - biquad[1] + biquad[2]) /
+            (biquad[3] - biquad[4] + biquad[5]);
+  }
+  ASSERT_NEAR(gain, std::pow(10, -1. / 20), 1e-9);
+}
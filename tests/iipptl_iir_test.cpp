@@ -0,0 +1,64 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include "iipptl_iir.hpp"
+
+using namespace IntelIppTL;
+
+template <typename IppType>
+class CIppIIRTest : public ::testing::Test {
+ public:
+};
+
+TYPED_TEST_CASE_P(CIppIIRTest);
+
+TYPED_TEST_P(CIppIIRTest, Streaming) {
+  auto const blockSize{256};
+  auto const design{ippIIRButterworth(4, 0.05)};
+  auto whole{CIppIIR<TypeParam>(design)};
+  auto streaming{CIppIIR<TypeParam>(design, 2)};
+  auto source{CIppVector<TypeParam>(2 * blockSize)};
+  auto dest{CIppVector<TypeParam>(2 * blockSize)};
+  source = 1;
+  whole.process(source, dest);
+  ASSERT_NEAR(dest[2 * blockSize - 1], 1, 1e-3);
+  auto block{CIppVector<TypeParam>(blockSize)};
+  for (int i{}; i < 2; ++i) {
+    block = 1;
+    streaming.process(block, 1);
+    ASSERT_NEAR(block[0], dest[i * blockSize], 1e-5);
+  }
+  auto copy{streaming};
+  auto copyBlock{CIppVector<TypeParam>(blockSize)};
+  block = 0;
+  copyBlock = 0;
+  streaming.process(block, 1);
+  copy.process(copyBlock, 1);
+  ASSERT_NEAR(block[0], copyBlock[0], 1e-9);
+  ASSERT_GT(block[0], 0.5);
+  copy = CIppIIR<TypeParam>{};
+  streaming = copy;
+  ASSERT_EQ(streaming.channels(), 0);
+  ASSERT_EQ(streaming.taps().size(), 0);
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppIIRTest, Streaming);
+using IppTypes = ::testing::Types<Ipp64f, Ipp32f>;
+INSTANTIATE_TYPED_TEST_CASE_P(IIR, CIppIIRTest, IppTypes);
@@ -0,0 +1,83 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include "iipptl_interleave.hpp"
+
+using namespace IntelIppTL;
+
+template <typename IppType>
+class CIppInterleaveTest : public ::testing::Test {
+ public:
+};
+
+TYPED_TEST_CASE_P(CIppInterleaveTest);
+
+TYPED_TEST_P(CIppInterleaveTest, RoundTrip) {
+  auto const channels{3};
+  auto const size{1000};
+  auto source{CIppVector<TypeParam>(channels * size)};
+  for (int sample{}; sample < source.size(); ++sample) {
+    source[sample] = TypeParam(sample % 1000);
+  }
+  auto split{std::vector<CIppVector<TypeParam>>(channels,
+                                                CIppVector<TypeParam>(size))};
+  ippDeinterleave(source, split);
+  ASSERT_EQ(split[0][1], TypeParam(3));
+  ASSERT_EQ(split[2][333], TypeParam(1));
+  auto block{CIppVector<TypeParam>(channels * size)};
+  ippDeinterleave(source, channels, block);
+  ASSERT_EQ(block[size + 10], split[1][10]);
+  auto dest{CIppVector<TypeParam>(channels * size)};
+  ippInterleave(split, dest);
+  ASSERT_EQ(dest[2999], source[2999]);
+  dest = 0;
+  ippInterleave(block, channels, dest);
+  ASSERT_EQ(dest[1234], source[1234]);
+  split.pop_back();
+  ASSERT_THROW(ippDeinterleave(source, split), std::invalid_argument);
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppInterleaveTest, RoundTrip);
+using IppTypes = ::testing::Types<Ipp16s, Ipp32f>;
+INSTANTIATE_TYPED_TEST_CASE_P(Interleave, CIppInterleaveTest, IppTypes);
+
+TEST(CIppInterleaveTest, Fused) {
+  auto const channels{2};
+  auto const size{5000};
+  auto source{CIppVector<Ipp16sc>(channels * size)};
+  for (int sample{}; sample < source.size(); ++sample) {
+    source[sample] = Ipp16sc{Ipp16s(sample % 2), Ipp16s(-(sample % 7))};
+  }
+  auto complex{std::vector<CIppVector32fc>(channels, CIppVector32fc(size))};
+  ippDeinterleave(source, complex, 0.5f);
+  ASSERT_FLOAT_EQ(complex[1][0].re, 0.5f);
+  ASSERT_FLOAT_EQ(complex[1][0].im, -0.5f);
+  ASSERT_FLOAT_EQ(complex[0][4999].re, 0.f);
+  ASSERT_FLOAT_EQ(complex[0][4999].im, -1.f);
+  auto raw{CIppVector<Ipp16s>(channels * size)};
+  for (int sample{}; sample < raw.size(); ++sample) {
+    raw[sample] = Ipp16s(sample % 2 == 0 ? sample % 100 : -1);
+  }
+  auto real{std::vector<CIppVector32f>(channels, CIppVector32f(size))};
+  ippDeinterleave(raw, real);
+  ASSERT_FLOAT_EQ(real[0][3000], 0.f);
+  ASSERT_FLOAT_EQ(real[0][3001], 2.f);
+  ASSERT_FLOAT_EQ(real[1][4321], -1.f);
+}
@@ -18,6 +18,8 @@
 
 #include "pch.h"
 
+#include <chrono>
+
 #include "iipptl_math.hpp"
 
 using namespace IntelIppTL;
@@ -28,3 +30,127 @@ class CIppMathTest : public ::testing::Test {
 };
 
 TYPED_TEST_CASE_P(CIppMathTest);
+
+// Round trips at one accuracy level; the tolerance follows the number of
+// correct bits the level guarantees.
+template <auto accuracy, typename IppType>
+void ippExpLnCheck(double tolerance) {
+  auto const vecSize{100};
+  auto source{CIppVector<IppType>(vecSize)};
+  auto exp{CIppVector<IppType>(vecSize)};
+  auto ln{CIppVector<IppType>(vecSize)};
+  source = 1.5;
+  ippExp<accuracy>(source, exp);
+  ippLn(exp, ln);
+  ASSERT_NEAR(ln[vecSize - 1], 1.5, tolerance);
+}
+
+template <auto accuracy, typename IppType>
+void ippSinCosCheck(double tolerance) {
+  auto const vecSize{100};
+  auto source{CIppVector<IppType>(vecSize)};
+  auto sin{CIppVector<IppType>(vecSize)};
+  auto cos{CIppVector<IppType>(vecSize)};
+  auto hypot{CIppVector<IppType>(vecSize)};
+  source = 0.7;
+  ippSinCos<accuracy>(source, sin, cos);
+  ippHypot<accuracy>(sin, cos, hypot);
+  ASSERT_NEAR(hypot[0], 1, tolerance);
+}
+
+TYPED_TEST_P(CIppMathTest, ExpLn) {
+  if constexpr (std::is_same_v<TypeParam, Ipp32f>) {
+    ippExpLnCheck<AccuracyLevels::SinglePrecision::A11, TypeParam>(1e-3);
+    ippExpLnCheck<AccuracyLevels::SinglePrecision::A21, TypeParam>(1e-5);
+    ippExpLnCheck<AccuracyLevels::SinglePrecision::A24, TypeParam>(1e-5);
+  } else {
+    ippExpLnCheck<AccuracyLevels::DoublePrecision::A26, TypeParam>(1e-6);
+    ippExpLnCheck<AccuracyLevels::DoublePrecision::A50, TypeParam>(1e-12);
+    ippExpLnCheck<AccuracyLevels::DoublePrecision::A53, TypeParam>(1e-12);
+  }
+}
+
+TYPED_TEST_P(CIppMathTest, SinCos) {
+  if constexpr (std::is_same_v<TypeParam, Ipp32f>) {
+    ippSinCosCheck<AccuracyLevels::SinglePrecision::A11, TypeParam>(1e-3);
+    ippSinCosCheck<AccuracyLevels::SinglePrecision::A21, TypeParam>(1e-5);
+    ippSinCosCheck<AccuracyLevels::SinglePrecision::A24, TypeParam>(1e-5);
+  } else {
+    ippSinCosCheck<AccuracyLevels::DoublePrecision::A26, TypeParam>(1e-6);
+    ippSinCosCheck<AccuracyLevels::DoublePrecision::A50, TypeParam>(1e-12);
+    ippSinCosCheck<AccuracyLevels::DoublePrecision::A53, TypeParam>(1e-12);
+  }
+}
+
+TYPED_TEST_P(CIppMathTest, PolarCart) {
+  auto const vecSize{100};
+  auto re{CIppVector<TypeParam>(vecSize)};
+  auto im{CIppVector<TypeParam>(vecSize)};
+  auto magnitude{CIppVector<TypeParam>(vecSize)};
+  auto phase{CIppVector<TypeParam>(vecSize)};
+  re = 3;
+  im = 4;
+  ippCartToPolar(re, im, magnitude, phase);
+  ASSERT_NEAR(magnitude[0], 5, 1e-5);
+  ippPolarToCart(magnitude, phase, re, im);
+  ASSERT_NEAR(re[vecSize - 1], 3, 1e-5);
+  ASSERT_NEAR(im[vecSize - 1], 4, 1e-5);
+  ippMulByConj(re, im, re, im, re, im);
+  ASSERT_NEAR(re[0], 25, 1e-4);
+  ASSERT_NEAR(im[0], 0, 1e-4);
+}
+
+TYPED_TEST_P(CIppMathTest, AddProductDot) {
+  auto const vecSize{100};
+  auto sourceA{CIppVector<TypeParam>(vecSize)};
+  auto sourceB{CIppVector<TypeParam>(vecSize)};
+  auto accumulator{CIppVector<TypeParam>(vecSize)};
+  sourceA = 2;
+  sourceB = 3;
+  accumulator = 1;
+  ippAddProduct(sourceA, sourceB, accumulator);
+  ASSERT_NEAR(accumulator[0], 7, 1e-5);
+  ippAddProductC(sourceA, TypeParam(0.5), accumulator);
+  ASSERT_NEAR(accumulator[vecSize - 1], 8, 1e-5);
+  ippMulCAdd(sourceB, TypeParam(2), sourceA, accumulator);
+  ASSERT_NEAR(accumulator[0], 8, 1e-5);
+  ASSERT_NEAR(ippDotProd(sourceA, sourceB), 6 * vecSize, 1e-3);
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppMathTest, ExpLn, SinCos, PolarCart,
+                           AddProductDot);
+using IppTypes = ::testing::Types<Ipp32f, Ipp64f>;
+INSTANTIATE_TYPED_TEST_CASE_P(Math, CIppMathTest, IppTypes);
+
+TEST(CIppMathBenchmark, PowerSpectrDB) {
+  using Clock = std::chrono::steady_clock;
+  auto const vecSize{1 << 20};
+  auto const repeats{20};
+  auto source{CIppVector32fc(vecSize)};
+  for (int i{}; i < vecSize; ++i) {
+    source[i] = {Ipp32f(i % 1000 + 1), Ipp32f(i % 77)};
+  }
+  auto chain{CIppVector32f(vecSize)};
+  auto fused{CIppVector32f(vecSize)};
+  auto const chainStart{Clock::now()};
+  for (int i{}; i < repeats; ++i) {
+    auto power{CIppVector32f(vecSize)};
+    ippPowerSpectr(source, power);
+    ippLog10(power, chain);
+    chain *= 10;
+  }
+  auto const fusedStart{Clock::now()};
+  for (int i{}; i < repeats; ++i) {
+    ippPowerSpectrDB(source, fused);
+  }
+  auto const fusedEnd{Clock::now()};
+  auto microseconds = [](auto duration) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration)
+        .count();
+  };
+  RecordProperty("chain_us", int(microseconds(fusedStart - chainStart)));
+  RecordProperty("fused_us", int(microseconds(fusedEnd - fusedStart)));
+  for (int i{}; i < vecSize; i += 997) {
+    ASSERT_NEAR(fused[i], chain[i], 1e-3);
+  }
+}
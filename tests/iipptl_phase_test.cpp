@@ -0,0 +1,63 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include <cmath>
+
+#include "iipptl_phase.hpp"
+
+using namespace IntelIppTL;
+
+template <typename IppType>
+class CIppPhaseTest : public ::testing::Test {
+ public:
+};
+
+TYPED_TEST_CASE_P(CIppPhaseTest);
+
+TYPED_TEST_P(CIppPhaseTest, Unwrap) {
+  using BaseType = Private::IppBaseTypeT<TypeParam>;
+  auto const vecSize{3000};
+  auto const step{0.5};
+  auto unwrap{CIppPhaseUnwrap<BaseType>()};
+  auto frequency{CIppInstFrequency<TypeParam>()};
+  auto source{CIppVector<TypeParam>(vecSize)};
+  auto phase{CIppVector<BaseType>(vecSize)};
+  auto unwrapped{CIppVector<BaseType>(vecSize)};
+  auto instFrequency{CIppVector<BaseType>(vecSize)};
+  for (int block{}; block < 2; ++block) {
+    for (int i{}; i < vecSize; ++i) {
+      auto const n{block * vecSize + i};
+      source[i] = {BaseType(std::cos(step * n)), BaseType(std::sin(step * n))};
+    }
+    unwrap.process(source, unwrapped);
+    frequency.process(source, instFrequency);
+    for (int i{}; i < vecSize; ++i) {
+      auto const n{block * vecSize + i};
+      ASSERT_NEAR(unwrapped[i], step * n, 1e-4 * n + 1e-4);
+      if (n > 0) {
+        ASSERT_NEAR(instFrequency[i], step, 1e-4);
+      }
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppPhaseTest, Unwrap);
+using IppTypes = ::testing::Types<Ipp32fc, Ipp64fc>;
+INSTANTIATE_TYPED_TEST_CASE_P(Phase, CIppPhaseTest, IppTypes);
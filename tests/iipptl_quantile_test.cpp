@@ -0,0 +1,46 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include "iipptl_quantile.hpp"
+
+using namespace IntelIppTL;
+
+template <typename IppType>
+class CIppQuantileTest : public ::testing::Test {
+ public:
+};
+
+TYPED_TEST_CASE_P(CIppQuantileTest);
+
+TYPED_TEST_P(CIppQuantileTest, Median) {
+  auto const vecSize{5000};
+  auto quantile{CIppQuantile<TypeParam>(vecSize, 0.5)};
+  auto input{CIppVector<TypeParam>(vecSize)};
+  for (int i{}; i < 20000; ++i) {
+    input = TypeParam(((i * 7919) % 1000) / 1000.);
+    quantile += input;
+  }
+  ASSERT_NEAR(quantile.data()[0], 0.5, 0.1);
+  ASSERT_NEAR(quantile.data()[vecSize - 1], 0.5, 0.1);
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppQuantileTest, Median);
+using IppTypes = ::testing::Types<Ipp32f, Ipp64f>;
+INSTANTIATE_TYPED_TEST_CASE_P(Quantile, CIppQuantileTest, IppTypes);
@@ -28,3 +28,22 @@ class CIppQueueTest : public ::testing::Test {
 };
 
 TYPED_TEST_CASE_P(CIppQueueTest);
+
+TEST(CIppQueueStorageTest, PushPop) {
+  auto queue{CIppQueue16f(3, 2)};
+  auto input{CIppVector32f(3)};
+  auto output{CIppVector32f(3)};
+  input[0] = 1.5;
+  input[1] = -0.25;
+  input[2] = 1024;
+  queue.push(input);
+  input = 0.1f;
+  queue.push(input);
+  ASSERT_TRUE(queue.full());
+  queue.pop(output);
+  ASSERT_EQ(output[0], 1.5);
+  ASSERT_EQ(output[1], -0.25);
+  ASSERT_EQ(output[2], 1024);
+  queue.pop(output);
+  ASSERT_FLOAT_EQ(output[0], 0.0999755859375f);
+}
@@ -0,0 +1,125 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include <chrono>
+#include <vector>
+
+#include "iipptl_resampler.hpp"
+
+using namespace IntelIppTL;
+
+template <typename IppType>
+class CIppResamplerTest : public ::testing::Test {
+ public:
+};
+
+TYPED_TEST_CASE_P(CIppResamplerTest);
+
+TYPED_TEST_P(CIppResamplerTest, DirectCurrent) {
+  auto const blockSize{960};
+  auto resampler{CIppResampler<TypeParam>(blockSize, 2, 3)};
+  auto source{CIppVector<TypeParam>(blockSize)};
+  source = 1;
+  for (int i{}; i < 4; ++i) {
+    ASSERT_EQ(resampler.process(source), blockSize * 2 / 3);
+  }
+  ASSERT_NEAR(resampler.data()[resampler.size() - 1], 1, 1e-3);
+}
+
+TYPED_TEST_P(CIppResamplerTest, Streaming) {
+  auto const signalSize{1200};
+  auto source{CIppVector<TypeParam>(signalSize)};
+  for (int i{}; i < signalSize; ++i) {
+    source[i] = TypeParam((i * 37) % 101) / 101;
+  }
+  auto whole{CIppResampler<TypeParam>(signalSize, 160, 147)};
+  whole.process(source);
+  auto streaming{CIppResampler<TypeParam>(signalSize, 160, 147)};
+  std::vector<TypeParam> output{};
+  for (int pos{}, step{1}; pos < signalSize; pos += step, step += 50) {
+    auto const size{std::min(step, signalSize - pos)};
+    auto block{CIppVector<TypeParam>(size)};
+    for (int i{}; i < size; ++i) {
+      block[i] = source[pos + i];
+    }
+    streaming.process(block);
+    output.insert(output.end(), streaming.data(),
+                  streaming.data() + streaming.size());
+  }
+  ASSERT_EQ(int(output.size()), whole.size());
+  for (int i{}; i < whole.size(); ++i) {
+    ASSERT_NEAR(output[i], whole.data()[i], 1e-5);
+  }
+}
+
+TYPED_TEST_P(CIppResamplerTest, Copy) {
+  auto empty{CIppResampler<TypeParam>()};
+  auto emptyCopy{empty};
+  ASSERT_EQ(emptyCopy.channels(), 0);
+  auto const blockSize{100};
+  auto resampler{CIppResampler<TypeParam>(blockSize, 3, 2)};
+  auto source{CIppVector<TypeParam>(blockSize - 1)};
+  for (int i{}; i < source.size(); ++i) {
+    source[i] = TypeParam(i % 7);
+  }
+  resampler.process(source);
+  auto copy{CIppResampler<TypeParam>()};
+  copy = resampler;
+  resampler.process(source);
+  copy.process(source);
+  ASSERT_EQ(copy.size(), resampler.size());
+  for (int i{}; i < copy.size(); ++i) {
+    ASSERT_EQ(copy.data()[i], resampler.data()[i]);
+  }
+  copy = empty;
+  ASSERT_EQ(copy.channels(), 0);
+  ASSERT_EQ(copy.taps().size(), 0);
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppResamplerTest, DirectCurrent, Streaming, Copy);
+using IppTypes = ::testing::Types<Ipp32f, Ipp64f>;
+INSTANTIATE_TYPED_TEST_CASE_P(Resampler, CIppResamplerTest, IppTypes);
+
+TEST(CIppResamplerBenchmark, CommonRatios) {
+  using Clock = std::chrono::steady_clock;
+  struct Ratio {
+    char const *name;
+    int up;
+    int down;
+  };
+  auto const ratios = {Ratio{"up_2_down_3", 2, 3},
+                       Ratio{"up_160_down_147", 160, 147},
+                       Ratio{"up_1_down_8", 1, 8},
+                       Ratio{"up_25_down_32", 25, 32}};
+  auto const blockSize{1 << 16};
+  auto const repeats{32};
+  auto source{CIppVector32fc(blockSize)};
+  source = Ipp32fc{1, -1};
+  for (auto const &ratio : ratios) {
+    auto resampler{CIppResampler32fc(blockSize, ratio.up, ratio.down)};
+    auto const start{Clock::now()};
+    for (int i{}; i < repeats; ++i) {
+      resampler.process(source);
+    }
+    std::chrono::duration<double> const elapsed{Clock::now() - start};
+    RecordProperty(ratio.name, int(blockSize * repeats / elapsed.count()));
+    ASSERT_GT(resampler.size(), 0);
+  }
+}
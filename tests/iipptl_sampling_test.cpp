@@ -28,3 +28,47 @@ class CIppSamplingTest : public ::testing::Test {
 };
 
 TYPED_TEST_CASE_P(CIppSamplingTest);
+
+TYPED_TEST_P(CIppSamplingTest, SampleDown) {
+  auto source{CIppVector<TypeParam>(10)};
+  auto dest{CIppVector<TypeParam>(5)};
+  for (int i{}; i < source.size(); ++i) {
+    source[i] = TypeParam(i);
+  }
+  ASSERT_EQ(ippSampleDown(source, dest, 3, 1), 3);
+  ASSERT_EQ(dest[2], 7);
+  ASSERT_THROW(ippSampleDown(source, dest, 2, 2), std::invalid_argument);
+}
+
+TYPED_TEST_P(CIppSamplingTest, StreamingDown) {
+  auto const blockSize{10};
+  auto const factor{3};
+  auto sampler{CIppSampler<TypeParam>(blockSize, factor)};
+  auto source{CIppVector<TypeParam>(blockSize)};
+  auto next{0};
+  for (int block{}; block < 7; ++block) {
+    for (int i{}; i < blockSize; ++i) {
+      source[i] = TypeParam(block * blockSize + i);
+    }
+    auto const expected{sampler.outputSize(blockSize)};
+    ASSERT_EQ(sampler.process(source), expected);
+    for (int i{}; i < sampler.size(); ++i, next += factor) {
+      ASSERT_EQ(sampler.data()[i], next);
+    }
+  }
+}
+
+TYPED_TEST_P(CIppSamplingTest, StreamingUp) {
+  auto const blockSize{4};
+  auto sampler{CIppSampler<TypeParam>(blockSize, 2, IppSamplingMode::Up, 1)};
+  auto source{CIppVector<TypeParam>(blockSize)};
+  source = 5;
+  ASSERT_EQ(sampler.process(source), 2 * blockSize);
+  ASSERT_EQ(sampler.data()[0], 0);
+  ASSERT_EQ(sampler.data()[1], 5);
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppSamplingTest, SampleDown, StreamingDown,
+                           StreamingUp);
+using IppTypes = ::testing::Types<Ipp32f, Ipp64f>;
+INSTANTIATE_TYPED_TEST_CASE_P(Sampling, CIppSamplingTest, IppTypes);
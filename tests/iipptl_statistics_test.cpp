@@ -0,0 +1,58 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include <cmath>
+
+#include "iipptl_statistics.hpp"
+
+using namespace IntelIppTL;
+
+template <typename IppType>
+class CIppStatisticsTest : public ::testing::Test {
+ public:
+};
+
+TYPED_TEST_CASE_P(CIppStatisticsTest);
+
+TYPED_TEST_P(CIppStatisticsTest, SinglePass) {
+  auto const vecSize{20000};
+  auto source{CIppVector<TypeParam>(vecSize)};
+  for (int i{}; i < vecSize; ++i) {
+    source[i] = TypeParam(i % 2 ? 3 : -1);
+  }
+  source[777] = 10;
+  source[15000] = -10;
+  auto const expectedNorm{std::sqrt(5. * (vecSize - 2) + 200)};
+  for (auto threads : {1, 4}) {
+    auto const result{ippStatistics(source, IppStatisticsFlags::All, threads)};
+    ASSERT_NEAR(result.mean, 1, 1e-3);
+    ASSERT_NEAR(result.stdDev, 2, 1e-2);
+    ASSERT_NEAR(result.normL2, expectedNorm, 1e-2);
+    ASSERT_EQ(result.minIndex, 15000);
+    ASSERT_EQ(result.maxIndex, 777);
+    ASSERT_EQ(result.max, 10);
+  }
+  auto const norm{ippStatistics(source, IppStatisticsFlags::NormL2)};
+  ASSERT_NEAR(norm.normL2, expectedNorm, 1e-2);
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppStatisticsTest, SinglePass);
+using IppTypes = ::testing::Types<Ipp32f, Ipp64f>;
+INSTANTIATE_TYPED_TEST_CASE_P(Statistics, CIppStatisticsTest, IppTypes);
@@ -0,0 +1,157 @@
+/*
+
+   Copyright 2019 Alexander Chernenko (achernenko@mail.ru)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+
+*/
+
+#include "pch.h"
+
+#include "iipptl_threshold.hpp"
+
+using namespace IntelIppTL;
+
+TEST(CIppCFARTest, Detect) {
+  auto const size{256};
+  auto source{CIppVector32f(size, 1)};
+  source[0] = 30;
+  source[100] = 50;
+  source[255] = 40;
+  for (auto mode : {IppCFARMode::CellAveraging, IppCFARMode::GreatestOf,
+                    IppCFARMode::OrderedStatistic}) {
+    auto cfar{CIppCFAR(size, 2, 16, 10, mode)};
+    auto indices{CIppVector32s(8)};
+    auto snr{CIppVector32f(8)};
+    ASSERT_EQ(cfar.detect(source, indices, snr), 3);
+    ASSERT_EQ(indices[0], 0);
+    ASSERT_EQ(indices[1], 100);
+    ASSERT_EQ(indices[2], 255);
+    ASSERT_NEAR(snr[0], 30, 1e-4);
+    ASSERT_NEAR(snr[1], 50, 1e-4);
+    ASSERT_NEAR(snr[2], 40, 1e-4);
+    indices.resize(2);
+    snr.resize(2);
+    ASSERT_EQ(cfar.detect(source, indices, snr), 2);
+  }
+}
+
+TEST(CIppCFARTest, GuardCells) {
+  auto const size{128};
+  auto source{CIppVector32f(size, 1)};
+  // A target spread over three cells: the guard cells keep the skirts out
+  // of the peak's noise estimate, while the skirts see the peak as noise.
+  source[63] = 20;
+  source[64] = 40;
+  source[65] = 20;
+  auto cfar{CIppCFAR(size, 1, 8, 10)};
+  auto indices{CIppVector32s(8)};
+  auto snr{CIppVector32f(8)};
+  ASSERT_EQ(cfar.detect(source, indices, snr), 1);
+  ASSERT_EQ(indices[0], 64);
+  ASSERT_NEAR(snr[0], 40, 1e-4);
+  ASSERT_THROW(CIppCFAR(size, 1, 0, 10), std::invalid_argument);
+}
+
+template <typename IppType>
+class CIppPeakFinderTest : public ::testing::Test {
+ public:
+};
+
+TYPED_TEST_CASE_P(CIppPeakFinderTest);
+
+TYPED_TEST_P(CIppPeakFinderTest, Find) {
+  auto const size{1000};
+  auto source{CIppVector<TypeParam>(size)};
+  source[0] = 2;
+  source[10] = 5;
+  source[11] = 6;
+  source[12] = 5;
+  source[300] = 3;
+  source[303] = 4;
+  source[600] = 9;
+  source[601] = 9;
+  source[999] = 7;
+  auto indices{CIppVector32s(16)};
+  auto values{CIppVector<TypeParam>(16)};
+  auto find{[&](CIppPeakFinder<TypeParam> finder) {
+    return finder.find(source, 1, indices, values);
+  }};
+  ASSERT_EQ(find(CIppPeakFinder<TypeParam>(size)), 9);
+  ASSERT_EQ(find(CIppPeakFinder<TypeParam>(size, true)), 6);
+  ASSERT_EQ(indices[1], 11);
+  ASSERT_EQ(indices[4], 600);
+  ASSERT_EQ(find(CIppPeakFinder<TypeParam>(size, true, 5)), 5);
+  ASSERT_EQ(indices[2], 303);
+  ASSERT_EQ(find(CIppPeakFinder<TypeParam>(size, true, 0, 2)), 2);
+  ASSERT_EQ(indices[0], 600);
+  ASSERT_EQ(indices[1], 999);
+  ASSERT_EQ(values[1], TypeParam(7));
+  ASSERT_EQ(find(CIppPeakFinder<TypeParam>(size, false, 3, 3)), 3);
+  ASSERT_EQ(indices[0], 11);
+  indices.resize(3);
+  values.resize(3);
+  ASSERT_EQ(find(CIppPeakFinder<TypeParam>(size)), 3);
+  ASSERT_EQ(indices[2], 11);
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppPeakFinderTest, Find);
+using IppTypes = ::testing::Types<Ipp64f, Ipp32f>;
+INSTANTIATE_TYPED_TEST_CASE_P(PeakFinder, CIppPeakFinderTest, IppTypes);
+
+template <typename IppType>
+class CIppHysteresisTest : public ::testing::Test {
+ public:
+};
+
+TYPED_TEST_CASE_P(CIppHysteresisTest);
+
+TYPED_TEST_P(CIppHysteresisTest, Update) {
+  auto const size{600};
+  auto hysteresis{CIppHysteresis<TypeParam>(size, 10, 5, 2)};
+  auto frame{CIppVector<TypeParam>(size)};
+  auto rising{CIppVector32s(1)};
+  auto falling{CIppVector32s(4)};
+  // Expected rising/falling counts per frame; the second rising edge of
+  // frame 1 does not fit into the buffer and is reported one frame later.
+  TypeParam const levels[]{12, 12, 12, 7, 4, 12, 4, 4, 4};
+  std::pair<int, int> const edges[]{{0, 0}, {1, 0}, {1, 0}, {0, 0}, {0, 0},
+                                    {0, 0}, {0, 0}, {0, 2}, {0, 0}};
+  for (int step{}; step < 9; ++step) {
+    frame[3] = levels[step];
+    frame[500] = levels[step];
+    auto const result{hysteresis.update(frame, rising, falling)};
+    ASSERT_EQ(result.first, edges[step].first);
+    ASSERT_EQ(result.second, edges[step].second);
+    if (step == 1) {
+      ASSERT_EQ(rising[0], 3);
+    } else if (step == 2) {
+      ASSERT_EQ(rising[0], 500);
+    }
+  }
+  ASSERT_FALSE(hysteresis.active(3));
+  ASSERT_EQ(falling[0], 3);
+  ASSERT_EQ(falling[1], 500);
+  // The postponed edge is still reported after the level drops back.
+  hysteresis.reset();
+  frame[3] = frame[500] = 12;
+  hysteresis.update(frame, rising, falling);
+  ASSERT_EQ(hysteresis.update(frame, rising, falling).first, 1);
+  frame[3] = frame[500] = 7;
+  ASSERT_EQ(hysteresis.update(frame, rising, falling).first, 1);
+  ASSERT_EQ(rising[0], 500);
+  ASSERT_TRUE(hysteresis.active(500));
+}
+
+REGISTER_TYPED_TEST_CASE_P(CIppHysteresisTest, Update);
+INSTANTIATE_TYPED_TEST_CASE_P(Hysteresis, CIppHysteresisTest, IppTypes);
@@ -22,13 +22,27 @@
 #include "iipptl_allocator.hpp"
 #include "iipptl_average.hpp"
 #include "iipptl_convert.hpp"
+#include "iipptl_ddc.hpp"
 #include "iipptl_delay.hpp"
 #include "iipptl_fft.hpp"
 #include "iipptl_fft_init.hpp"
 #include "iipptl_fft_param.hpp"
+#include "iipptl_fir.hpp"
+#include "iipptl_fir_design.hpp"
+#include "iipptl_fir_init.hpp"
+#include "iipptl_fixed.hpp"
+#include "iipptl_float16.hpp"
+#include "iipptl_hilbert.hpp"
+#include "iipptl_iir.hpp"
+#include "iipptl_iir_design.hpp"
+#include "iipptl_interleave.hpp"
 #include "iipptl_math.hpp"
+#include "iipptl_phase.hpp"
+#include "iipptl_quantile.hpp"
 #include "iipptl_queue.hpp"
+#include "iipptl_resampler.hpp"
 #include "iipptl_sampling.hpp"
+#include "iipptl_statistics.hpp"
 #include "iipptl_threshold.hpp"
 #include "iipptl_vector.hpp"
 